@@ -1,3 +1,3 @@
-﻿// 1_balance_release.cpp: файл заголовка для целевого объекта.
-
-#pragma once
+// 1_balance_release.cpp: файл заголовка для целевого объекта.
+
+#pragma once
@@ -0,0 +1,63 @@
+#include "BoardCombinations.h"
+
+#include <stdexcept>
+
+BoardCombinations::BoardCombinations(int cellsNum_, int itemsNum_)
+	: cellsNum(cellsNum_), itemsNum(itemsNum_) {
+	if (cellsNum < 0 || cellsNum > 64 || itemsNum < 0 || itemsNum > cellsNum) {
+		throw std::invalid_argument("Board must have no more than 64 cells and no more items than cells");
+	}
+
+	binomials.assign((cellsNum + 1) * (itemsNum + 1), 0);
+	for (int n = 0; n <= cellsNum; n++) {
+		binomials[n * (itemsNum + 1)] = 1;
+		for (int k = 1; k <= itemsNum && k <= n; k++) {
+			binomials[n * (itemsNum + 1) + k] = Binomial(n - 1, k - 1) + Binomial(n - 1, k);
+		}
+	}
+}
+
+uint64_t BoardCombinations::Unrank(uint64_t rank) const {
+
+	// Ячейки перебираются по возрастанию: досок, у которых
+	// очередной предмет лежит в ячейке cell, C(cellsNum - cell - 1, left - 1).
+	// Если номер меньше их количества, предмет кладётся в cell,
+	// иначе эти доски пропускаются
+
+	if (rank >= Size()) {
+		throw std::out_of_range("Board rank must be less than the number of boards");
+	}
+
+	uint64_t board = 0;
+	int left = itemsNum;
+	for (int cell = 0; cell < cellsNum && left > 0; cell++) {
+		uint64_t withCell = Binomial(cellsNum - cell - 1, left - 1);
+		if (rank < withCell) {
+			board |= uint64_t{ 1 } << cell;
+			left--;
+		}
+		else {
+			rank -= withCell;
+		}
+	}
+	return board;
+}
+
+uint64_t BoardCombinations::Rank(uint64_t board) const {
+
+	// Обратный к Unrank перебор: за каждую пустую ячейку
+	// перед очередным предметом номер увеличивается
+	// на количество досок с предметом в этой ячейке
+
+	uint64_t rank = 0;
+	int left = itemsNum;
+	for (int cell = 0; cell < cellsNum && left > 0; cell++) {
+		if (board & (uint64_t{ 1 } << cell)) {
+			left--;
+		}
+		else {
+			rank += Binomial(cellsNum - cell - 1, left - 1);
+		}
+	}
+	return rank;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+
+/////////////////////BoardCombinations///////////////////////
+// Нумерация начальных досок Грибной поляны без их хранения.
+// Доска - сочетание из itemsNum ячеек поля из cellsNum,
+// записанное битовой маской. Номер доски - номер сочетания
+// в лексикографическом порядке (в том же порядке доски
+// перебирались при заполнении списка boardVariants), поэтому
+// номера действий случайного узла и файлы деревьев не меняются.
+// Маска по номеру и номер по маске считаются через таблицу
+// биномиальных коэффициентов за O(cellsNum)
+
+class BoardCombinations {
+public:
+	// cellsNum - количество ячеек поля (не больше 64),
+	// itemsNum - количество предметов на доске
+	BoardCombinations(int cellsNum, int itemsNum);
+
+	// Количество досок: число сочетаний из cellsNum по itemsNum
+	uint64_t Size() const { return Binomial(cellsNum, itemsNum); }
+
+	// Маска ячеек с предметами для доски с номером rank.
+	// Номер не меньше Size() - исключение std::out_of_range
+	uint64_t Unrank(uint64_t rank) const;
+
+	// Номер доски по маске ячеек с предметами
+	uint64_t Rank(uint64_t board) const;
+
+	int CellsNum() const { return cellsNum; }
+	int ItemsNum() const { return itemsNum; }
+
+private:
+	// Число сочетаний из n по k (0 при k > n)
+	uint64_t Binomial(int n, int k) const {
+		return binomials[n * (itemsNum + 1) + k];
+	}
+
+	int cellsNum;
+	int itemsNum;
+	// Треугольник Паскаля для n <= cellsNum, k <= itemsNum
+	std::vector<uint64_t> binomials;
+};
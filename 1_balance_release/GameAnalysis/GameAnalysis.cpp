@@ -1,739 +1,2587 @@
-#include "GameAnalysis.h"
-
-//using namespace nvx;
-
-//////////////////////////////////////StateOutcomesTree/////////////////////////////////////////
-
-std::unique_ptr<StateTree> StateOutcomesTree::InitialStateTree(
-	std::unique_ptr<open_spiel::State> state_) {
-
-	//     
-
-	if (state_->IsTerminal()) {
-		//       
-		std::unique_ptr<StateTree> infoState = std::make_unique<StateTree>();
-		auto result = state_->Returns()[0];
-		if (result > 0) {
-			//   
-			infoState->winFirstPlayerSum = 1;
-			infoState->winSecondPlayerSum = 0;
-			infoState->equalResultsSum = 0;
-		}
-		else if (result < 0) {
-			//   
-			infoState->winFirstPlayerSum = 0;
-			infoState->winSecondPlayerSum = 1;
-			infoState->equalResultsSum = 0;
-		}
-		else {
-			// 
-			infoState->winFirstPlayerSum = 0;
-			infoState->winSecondPlayerSum = 0;
-			infoState->equalResultsSum = 1;
-		}
-		return std::move(infoState);
-	}
-
-	//     ,     , 
-	//       
-	std::unique_ptr<StateTree> infoState = std::make_unique<StateTree>();
-	for (auto action_ : state_->LegalActions()) {
-		infoState->states[action_] = 
-			InitialStateTree(std::move(state_->Child(action_)));
-		infoState->winFirstPlayerSum += 
-			infoState->states[action_]->winFirstPlayerSum;
-		infoState->winSecondPlayerSum += 
-			infoState->states[action_]->winSecondPlayerSum;
-		infoState->equalResultsSum += 
-			infoState->states[action_]->equalResultsSum;
-	}
-	return std::move(infoState);
-}
-
-void StateOutcomesTree::FindStateTree(std::unique_ptr<open_spiel::State> state_) {
-
-	//        
-	if (state_->IsChanceNode()) {
-
-		infoStateTree = std::make_unique<StateTree>();///////////
-	
-		std::vector<std::pair<open_spiel::Action, double>> outcomes =
-			state_->ChanceOutcomes();
-
-
-		for (auto action_ : outcomes) {
-			infoStateTree->states[action_.first] = InitialStateTree(std::move(state_->Child(action_.first)));
-			infoStateTree->winFirstPlayerSum += infoStateTree->states[action_.first]->winFirstPlayerSum;
-			infoStateTree->winSecondPlayerSum += infoStateTree->states[action_.first]->winSecondPlayerSum;
-			infoStateTree->equalResultsSum += infoStateTree->states[action_.first]->equalResultsSum;
-		}
-	}
-	else {
-		infoStateTree = InitialStateTree(std::move(state_));
-	}
-	
-}
-
-std::unique_ptr<StateTree> StateOutcomesTree::GetTree() {
-
-	//      
-
-	return std::move(infoStateTree);
-}
-
-void StateOutcomesTree::SetTree(std::unique_ptr<StateTree> infoState) {
-
-	//     
-
-	infoStateTree = std::move(infoState);
-}
-
-void StateOutcomesTree::Serialize(std::string fileName) {
-	//infoStateTree->saveToBinaryMMap(fileName);
-
-	std::cout << "Outcomes serialize...\n";
-	auto start = std::chrono::high_resolution_clock::now();
-
-	std::ofstream fout(fileName, std::ios::binary);
-	//archive(&fout) << &infoStateTree;
-	infoStateTree->saveToBinary(fout);
-	fout.close();
-
-	auto end = std::chrono::high_resolution_clock::now();
-	//  
-	std::chrono::duration<double> duration = end - start;
-	std::cout << "Outcomes serialized. Time = " << duration.count() << " s.\n";
-}
-
-void StateOutcomesTree::Deserialize(std::string fileName) {
-	//infoStateTree->loadFromBinaryMMap(fileName);
-
-	std::cout << "Outcomes deserialize...\n";
-	auto start = std::chrono::high_resolution_clock::now();
-	
-	std::ifstream fin(fileName, std::ios::binary);
-	//archive(&fin) >> &infoStateTree;
-	infoStateTree->loadFromBinary(fin);
-	fin.close();
-
-	auto end = std::chrono::high_resolution_clock::now();
-	//  
-	std::chrono::duration<double> duration = end - start;
-	std::cout << "Outcomes deserialized. Time = " << duration.count() << " s.\n";
-}
-
-void StateOutcomesTree::FindAndSerializeStateTree(
-	std::unique_ptr<open_spiel::State> state_, 
-	std::string gameName, std::string gameLength, 
-	std::string boardSize, std::string statisticFile,
-	std::string logFile, int slice_step) {
-
-	//       
-	//   (outcomes)  state_. 
-	//       
-	//   subsets     
-	//     (diff).
-	//      , 
-	//        
-	//        statisticFile.
-	//      
-	//  slice_step  ,      
-	//       
-	//  .      
-	// /  .
-
-	//      
-	// () 
-	if (state_->IsChanceNode()) {
-
-		//     
-		std::vector<std::pair<open_spiel::Action, double>> outcomes =
-			state_->ChanceOutcomes();
-
-		// ,    
-		//     
-		std::vector<std::unique_ptr<StateTree>> subsets;
-
-		for (int i = 0; i < 17; i++) {
-			subsets.push_back(std::make_unique<StateTree>());
-		}
-
-		//     
-		std::vector<std::string> fileNames{
-			"_equalTree0_20.bin",
-			"_firstPlayerTree0_5.bin",
-			"_firstPlayerTree5_10.bin",
-			"_firstPlayerTree10_15.bin",
-			"_firstPlayerTree15_20.bin",
-			"_firstPlayerTree20_25.bin",
-			"_firstPlayerTree25_30.bin",
-			"_firstPlayerTree30_35.bin",
-			"_firstPlayerTree35_40.bin",
-			"_secondPlayerTree0_5.bin",
-			"_secondPlayerTree5_10.bin",
-			"_secondPlayerTree10_15.bin",
-			"_secondPlayerTree15_20.bin",
-			"_secondPlayerTree20_25.bin",
-			"_secondPlayerTree25_30.bin",
-			"_secondPlayerTree30_35.bin",
-			"_secondPlayerTree35_40.bin",
-		};
-
-		//        
-		//        
-		std::ofstream out;
-		out.open(statisticFile, std::ios::app);
-		std::cout << "Open log file for writting...\n";
-		out << "File_name;Strategies_count;Game_length;Board-size;" 
-			<< "First_player_wins_num;Second_player_wins_num;" 
-			<< "Equal_results_num;All_variants_num;" 
-			<< "First_player_wins_percent;Second_player_wins_percent;" 
-			<< "Equal_results_percent;\n";
-		out.close();
-
-		auto start = std::chrono::high_resolution_clock::now();
-
-		//      
-		int slice = outcomes.size() / slice_step, step = 1, number = 0;
-
-		//     
-		for (auto action_ : outcomes) {
-
-			if (step < slice) {
-				step++;
-				std::unique_ptr<StateTree> infoState = 
-					InitialStateTree(std::move(state_->
-						Child(action_.first)
-					));
-			
-				double allRez = infoState->winFirstPlayerSum 
-					+ infoState->winSecondPlayerSum 
-					+ infoState->equalResultsSum;
-				double equalResultsPercent = 
-					infoState->equalResultsSum / allRez;
-
-
-				double firstPlayerPercent = 
-					infoState->winFirstPlayerSum / allRez;
-				double secondPlayerPercent = 
-					infoState->winSecondPlayerSum / allRez;
-				
-				//     
-				//   .
-				//      
-				//     
-				double diff = firstPlayerPercent - secondPlayerPercent, 
-					diff1 = -diff;
-
-				//      
-				//     
-				if (abs(diff) < 0.01 && equalResultsPercent < 0.2) {
-					//      
-					//    
-					subsets[0]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[0]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[0]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[0]->states[action_.first] 
-						= std::move(infoState);
-				}
-
-				else if (diff <= 0.05 && diff > 0.01) {
-					//       5%
-					subsets[1]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[1]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[1]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[1]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff <= 0.1 && diff > 0.05) {
-					//       10%
-					subsets[2]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[2]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[2]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[2]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff <= 0.15 && diff > 0.1) {
-					//       15%
-					subsets[3]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[3]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[3]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[3]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff <= 0.2 && diff > 0.15) {
-					//       20%
-					subsets[4]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[4]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[4]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[4]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff <= 0.25 && diff > 0.2) {
-					//       25%
-					subsets[5]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[5]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[5]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[5]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff <= 0.3 && diff > 0.25) {
-					//       30%
-					subsets[6]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[6]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[6]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[6]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff <= 0.35 && diff > 0.3) {
-					//       35%
-					subsets[7]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[7]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[7]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[7]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff <= 0.4 && diff > 0.35) {
-					//       40%
-					subsets[8]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[8]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[8]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[8]->states[action_.first] 
-						= std::move(infoState);
-				}
-
-				else if (diff1 <= 0.05 && diff1 > 0.01) {
-					//       5%
-					subsets[9]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[9]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[9]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[9]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff1 <= 0.1 && diff1 > 0.05) {
-					//       10%
-					subsets[10]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[10]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[10]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[10]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff1 <= 0.15 && diff1 > 0.1) {
-					//       15%
-					subsets[11]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[11]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[11]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[11]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff1 <= 0.2 && diff1 > 0.15) {
-					//       20%
-					subsets[12]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[12]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[12]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[12]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff1 <= 0.25 && diff1 > 0.2) {
-					//       25%
-					subsets[13]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[13]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[13]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[13]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff1 <= 0.3 && diff1 > 0.25) {
-					//       30%
-					subsets[14]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[14]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[14]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[14]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff1 <= 0.35 && diff1 > 0.3) {
-					//       35%
-					subsets[15]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[15]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[15]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[15]->states[action_.first] 
-						= std::move(infoState);
-				}
-				else if (diff1 <= 0.4 && diff1 > 0.35) {
-					//       40%
-					subsets[16]->winFirstPlayerSum 
-						+= infoState->winFirstPlayerSum;
-					subsets[16]->winSecondPlayerSum 
-						+= infoState->winSecondPlayerSum;
-					subsets[16]->equalResultsSum 
-						+= infoState->equalResultsSum;
-					subsets[16]->states[action_.first] 
-						= std::move(infoState);
-				}
-			}
-			else {
-
-				//    
-
-				step = 1;
-				number++;
-
-				for (int i = 0; i < 17; i++) {
-					subsets.push_back(std::make_unique<StateTree>());
-					SerializeStateTree(
-						std::move(subsets[i]), statisticFile,
-						logFile, std::to_string(number) + 
-						"_" + gameName + fileNames[i],
-						gameLength, boardSize);
-				}
-
-				for (int i = 0; i < 17; i++) {
-					subsets[i] = std::make_unique<StateTree>();
-				}
-			}
-	
-		}
-
-		auto end = std::chrono::high_resolution_clock::now();
-		//  
-		std::chrono::duration<double> duration = end - start;
-		std::ofstream out1(logFile, std::ios::app);
-		out1 << "Outcomes counted. Time = " << duration.count() << " s.\n";
-		out1.close();
-
-
-		std::cout << "Log file has been written" << std::endl;
-	}
-	else {
-		infoStateTree = InitialStateTree(std::move(state_));
-	}
-}
-
-void StateOutcomesTree::SerializeStateTree(
-	std::unique_ptr<StateTree> infoState, 
-	std::string statisticFile,
-	std::string logFile, std::string treeFileName,
-	std::string gameLength, std::string boardSize) {
-
-	//    .
-	//    statisticFile  
-	//   .
-	
-	// treeFileName -    , 
-	//      ,
-	// gameLength, boardSize -   ,
-	// winX, winO, equalRezults -   
-	//     ,
-	// allWins -   , 
-	//    .
-
-	//      
-	//      treeFileName
-
-	int winX = infoState->winFirstPlayerSum, 
-		winO = infoState->winSecondPlayerSum, 
-		equalRezults = infoState->equalResultsSum;
-	double allWins = winX + winO + equalRezults;
-
-	std::ofstream out;
-	out.open(statisticFile, std::ios::app);
-	out << treeFileName << ";" << infoState->states.size() << ";" 
-		<< gameLength << ";" << boardSize << ";" <<
-		winX << ";" << winO << ";" << equalRezults << ";" 
-		<< allWins << ";" << winX / allWins << ";" 
-		<< winO / allWins << ";" << equalRezults / allWins 
-		<< ";" << "\n";
-	out.close();
-
-	out.open(logFile, std::ios::app);
-	out << "1. " << treeFileName << " outcomes serialize...\n";
-	auto start = std::chrono::high_resolution_clock::now();
-
-	std::ofstream fout(treeFileName, std::ios::binary);
-	infoState->saveToBinary(fout);
-	fout.close();
-	
-	auto end = std::chrono::high_resolution_clock::now();
-	//  
-	std::chrono::duration<double> duration = end - start;
-	out << "Outcomes serialized. Time = " << duration.count() << " s.\n";
-	out.close();
-}
-
-
-//////////////////////////////////////GameAnalysis/////////////////////////////////////////
-
-std::string GameAnalysis::GetStartedStateHistory() const {
-
-	//     
-
-	return "optimalStartedState->stateHistory";
-}
-
-std::unique_ptr<int[]> GameAnalysis::GetStartedStateOutcomesNum() {
-
-	//      
-
-	std::unique_ptr<int[]> result{
-		new int[3] {
-			optimalStartedState->winFirstPlayerSum,
-			optimalStartedState->winSecondPlayerSum,
-			optimalStartedState->equalResultsSum
-		}
-	};
-	return std::move(result);
-}
-
-//////////////////////////////////////TreeAnalysis/////////////////////////////////////////
-
-std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) {
-	
-}
-
-//////////////////////////////////////FirstPlayerAnalysis/////////////////////////////////////////
-
-std::unique_ptr<StateTree> FirstPlayerAnalysis::FirstPlayerStartedStateSearch(std::unique_ptr<StateTree> infoState, int depth) {
-
-	//             
-
-	if (depth == depthLimit - 1) {
-
-
-		int winFirstPlayer = infoState->winFirstPlayerSum;
-		int winSecondPlayer = infoState->winSecondPlayerSum;
-		double sumRez = winFirstPlayer + winSecondPlayer + infoState->equalResultsSum;
-
-		double diff = (winSecondPlayer - winFirstPlayer) / sumRez;
-
-		if (diff < minDiff) {
-			minDiff = diff;
-
-			optimalStartedState->winFirstPlayerSum = infoState->winFirstPlayerSum;
-			optimalStartedState->winSecondPlayerSum = infoState->winSecondPlayerSum;
-			optimalStartedState->equalResultsSum = infoState->equalResultsSum;
-			//optimalStartedState->stateHistory = infoState->stateHistory;
-		}
-	}
-
-	for (auto& stateElement : infoState->states) {
-		stateElement.second = FirstPlayerStartedStateSearch(std::move(stateElement.second), depth + 1);
-	}
-
-	return std::move(infoState);
-}
-
-std::unique_ptr<StateTree> FirstPlayerAnalysis::StartedStateSearch(std::unique_ptr<StateTree> infoState, int depthLimit_) {
-
-	//        (   )
-
-	optimalStartedState = std::make_unique<StateTree>();
-	this->depthLimit = depthLimit_;
-	this->minDiff = 100;
-
-	return FirstPlayerStartedStateSearch(std::move(infoState), 0);
-}
-
-//////////////////////////////////////SecondPlayerAnalysis/////////////////////////////////////////
-
-std::unique_ptr<StateTree> SecondPlayerAnalysis::SecondPlayerStartedStateSearch(std::unique_ptr<StateTree> infoState, int depth) {
-
-	//             
-
-	if (depth == depthLimit - 1) {
-
-
-		int winFirstPlayer = infoState->winFirstPlayerSum;
-		int winSecondPlayer = infoState->winSecondPlayerSum;
-		double sumRez = winFirstPlayer + winSecondPlayer + infoState->equalResultsSum;
-
-		double diff = (winFirstPlayer - winSecondPlayer) / sumRez;
-
-		if (diff < minDiff) {
-			minDiff = diff;
-
-			optimalStartedState->winFirstPlayerSum = infoState->winFirstPlayerSum;
-			optimalStartedState->winSecondPlayerSum = infoState->winSecondPlayerSum;
-			optimalStartedState->equalResultsSum = infoState->equalResultsSum;
-			//optimalStartedState->stateHistory = infoState->stateHistory;
-		}
-	}
-
-	for (auto& stateElement : infoState->states) {
-		stateElement.second = SecondPlayerStartedStateSearch(std::move(stateElement.second), depth + 1);
-	}
-	return std::move(infoState);
-}
-
-std::unique_ptr<StateTree> SecondPlayerAnalysis::StartedStateSearch(std::unique_ptr<StateTree> infoState, int depthLimit_) {
-
-	//        (   )
-
-	optimalStartedState = std::make_unique<StateTree>();
-	this->depthLimit = depthLimit_;
-	this->minDiff = 100;
-
-	return SecondPlayerStartedStateSearch(std::move(infoState), 0);
-}
-
-//////////////////////////////////////EqualResultAnalysis/////////////////////////////////////////
-
-std::unique_ptr<StateTree> EqualResultAnalysis::EqualResultStartedStateSearch(std::unique_ptr<StateTree> infoState, int depth) {
-
-	//             
-
-	if (depth == depthLimit - 1) {
-
-
-		int winFirstPlayer = infoState->winFirstPlayerSum;
-		int winSecondPlayer = infoState->winSecondPlayerSum;
-		double sumRez = winFirstPlayer + winSecondPlayer + infoState->equalResultsSum;
-
-		double diff = abs(winFirstPlayer - winSecondPlayer) / sumRez;
-
-		if (diff < minDiff) {
-			minDiff = diff;
-
-			optimalStartedState->winFirstPlayerSum = infoState->winFirstPlayerSum;
-			optimalStartedState->winSecondPlayerSum = infoState->winSecondPlayerSum;
-			optimalStartedState->equalResultsSum = infoState->equalResultsSum;
-			//optimalStartedState->stateHistory = infoState->stateHistory;
-		}
-	}
-
-	for (auto& stateElement : infoState->states) {
-		stateElement.second = EqualResultStartedStateSearch(std::move(stateElement.second), depth + 1);
-	}
-	return std::move(infoState);
-}
-
-std::unique_ptr<StateTree> EqualResultAnalysis::StartedStateSearch(std::unique_ptr<StateTree> infoState, int depthLimit_) {
-
-	//        (   )
-
-	optimalStartedState = std::make_unique<StateTree>();
-	this->depthLimit = depthLimit_;
-	this->minDiff = 100;
-
-	return EqualResultStartedStateSearch(std::move(infoState), 0);
-}
-
-//////////////////////////////////////ChanceNodeGameAnalysis/////////////////////////////////////////
-
-void ChanceNodeGameAnalysis::StrategyNum(std::unique_ptr<open_spiel::State> state_) {
-	if (state_->IsTerminal()) {
-		auto result = state_->Returns()[0];
-		if (result > 0) {
-			winFirstPlayer += 1;
-		}
-		else if (result < 0) {
-			winSecondPlayer += 1;
-		}
-		else {
-			equalRezult += 1;
-		}
-		return;
-	}
-	for (auto action_ : state_->LegalActions()) {
-		StrategyNum(std::move(state_->Child(action_)));
-	}
-}
-
-std::vector<int> ChanceNodeGameAnalysis::GetStrategyNum(std::unique_ptr<open_spiel::State> state_) {
-	winFirstPlayer = 0;
-	winSecondPlayer = 0;
-	equalRezult = 0;
-	chanceNodeNum = 0;
-
-	if (state_->IsChanceNode()) {
-		std::vector<std::pair<open_spiel::Action, double>> outcomes =
-			state_->ChanceOutcomes();
-		chanceNodeNum = outcomes.size();
-		for (auto action_ : outcomes) {
-			StrategyNum(std::move(state_->Child(action_.first)));
-		}
-	}
-
-	std::vector<int> results{winFirstPlayer, winSecondPlayer, equalRezult, chanceNodeNum};
-	return results;
-}
-
-std::vector<std::vector<int>> ChanceNodeGameAnalysis::GetSplitStrategyNum(std::unique_ptr<open_spiel::State> state_, int split_) {
-	winFirstPlayer = 0;
-	winSecondPlayer = 0;
-	equalRezult = 0;
-	chanceNodeNum = 0;
-
-	std::vector<std::vector<int>> results;
-	results.reserve(split_ + 1);
-
-	if (state_->IsChanceNode()) {
-		std::vector<std::pair<open_spiel::Action, double>> outcomes =
-			state_->ChanceOutcomes();
-		chanceNodeNum = outcomes.size();
-
-		int splitNum = chanceNodeNum / split_, splitCheck = 0;
-		for (auto action_ : outcomes) {
-			StrategyNum(std::move(state_->Child(action_.first)));
-
-			splitCheck++;
-			if (splitCheck % splitNum == 0) {
-				std::vector<int> result{ winFirstPlayer, winSecondPlayer, equalRezult, splitCheck };
-				results.push_back(result);
-				winFirstPlayer = 0;
-				winSecondPlayer = 0;
-				equalRezult = 0;
-			}
-		}
-	}
-
-	std::vector<int> result{ winFirstPlayer, winSecondPlayer, equalRezult, chanceNodeNum };
-	results.push_back(result);
-	return results;
+#include "GameAnalysis.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//using namespace nvx;
+
+//////////////////////////////////////StateTraversal/////////////////////////////////////////
+
+StateTraversal::StateTraversal(open_spiel::State& state_)
+	: state(state_),
+	gladeState(dynamic_cast<const MushroomGladeInterface*>(&state_)) {
+
+	// Буферы создаются сразу на всю глубину игры, 
+	// чтобы при обходе память больше не выделялась
+
+	int depthNum = state.GetGame()->MaxGameLength() + 1;
+	maxActionsNum = gladeState ? gladeState->MaxLegalActionsNum() : 0;
+	actionBuffers.resize(depthNum);
+	for (auto& buffer : actionBuffers) {
+		buffer.resize(maxActionsNum);
+	}
+	for (auto& order : bonusOrders) {
+		order.reserve(maxActionsNum);
+	}
+
+	ordersNums[0] = 1;
+	for (int i = 1; i <= kMaxDecidedMovesNum; i++) {
+		ordersNums[i] = ordersNums[i - 1] * i;
+	}
+}
+
+const open_spiel::Action* StateTraversal::LegalActions(int depth, int& actionsNum) {
+	if (static_cast<size_t>(depth) >= actionBuffers.size()) {
+		actionBuffers.resize(depth + 1);
+		actionBuffers[depth].resize(maxActionsNum);
+	}
+	std::vector<open_spiel::Action>& buffer = actionBuffers[depth];
+
+	if (gladeState) {
+		actionsNum = gladeState->LegalActionsInto(buffer.data());
+	}
+	else {
+		buffer = state.LegalActions();
+		actionsNum = buffer.size();
+	}
+	return buffer.data();
+}
+
+int StateTraversal::FirstPlayerResult() const {
+	if (gladeState) {
+		return gladeState->FirstPlayerResult();
+	}
+	auto result = state.Returns()[0];
+	return (result > 0) - (result < 0);
+}
+
+void StateTraversal::PrepareBonusBounds(const open_spiel::Action* actions, int actionsNum) {
+
+	// Границы считаются только для ячеек, 
+	// которые помещаются в 64-битную маску
+
+	boundsReady = gladeState != nullptr;
+	for (int i = 0; i < actionsNum && boundsReady; i++) {
+		boundsReady = actions[i] >= 0 && actions[i] < 64;
+	}
+	if (!boundsReady) {
+		return;
+	}
+
+	for (open_spiel::Player player = 0; player < 2; player++) {
+		auto& order = bonusOrders[player];
+		order.clear();
+		for (int i = 0; i < actionsNum; i++) {
+			order.emplace_back(gladeState->ItemBonus(player, actions[i]), uint64_t{ 1 } << actions[i]);
+		}
+		std::sort(order.begin(), order.end(), std::greater<>());
+		if (actionsNum > 0) {
+			maxBonus[player] = order.front().first;
+			minBonus[player] = order.back().first;
+		}
+	}
+}
+
+bool StateTraversal::DecidedResult(const open_spiel::Action* actions, int actionsNum, int& result) const {
+
+	// Игрок, который ходит, возьмёт ceil(k/2) из k оставшихся предметов, 
+	// соперник - floor(k/2). Наибольшая и наименьшая сумма предметов 
+	// игрока - первые и последние оставшиеся ячейки в его порядке ценностей
+
+	if (!boundsReady || actionsNum == 0 || actionsNum > kMaxDecidedMovesNum
+		|| actionsNum != gladeState->MovesLeft()) {
+		return false;
+	}
+
+	open_spiel::Player mover = state.CurrentPlayer();
+	int difference = gladeState->EarnedBonus(0) - gladeState->EarnedBonus(1);
+
+	// Последний ход: исход известен точно
+	if (actionsNum == 1) {
+		int bonus = gladeState->ItemBonus(mover, actions[0]);
+		difference += mover == 0 ? bonus : -bonus;
+		result = (difference > 0) - (difference < 0);
+		return true;
+	}
+
+	int movesNum[2];
+	movesNum[mover] = (actionsNum + 1) / 2;
+	movesNum[1 - mover] = actionsNum / 2;
+
+	// Грубая проверка по крайним ценностям корня: 
+	// если даже она не решает исход, точные границы не считаются
+	if (difference + movesNum[0] * maxBonus[0] - movesNum[1] * minBonus[1] <= 0
+		&& difference + movesNum[0] * minBonus[0] - movesNum[1] * maxBonus[1] >= 0) {
+		return false;
+	}
+
+	uint64_t restCells = 0;
+	for (int i = 0; i < actionsNum; i++) {
+		restCells |= uint64_t{ 1 } << actions[i];
+	}
+
+	int most[2], least[2];
+	int restBonus[kMaxDecidedMovesNum];
+	for (open_spiel::Player player = 0; player < 2; player++) {
+		int restNum = 0;
+		for (const auto& [bonus, cellBit] : bonusOrders[player]) {
+			if (restCells & cellBit) {
+				restBonus[restNum++] = bonus;
+			}
+		}
+		most[player] = 0;
+		least[player] = 0;
+		for (int i = 0; i < movesNum[player]; i++) {
+			most[player] += restBonus[i];
+			least[player] += restBonus[restNum - 1 - i];
+		}
+	}
+
+	int lowest = difference + least[0] - most[1];
+	int highest = difference + most[0] - least[1];
+	if (lowest > 0) {
+		result = 1;
+	}
+	else if (highest < 0) {
+		result = -1;
+	}
+	else {
+		return false;
+	}
+	return true;
+}
+
+//////////////////////////////////////IndexedStateTreeFile/////////////////////////////////////////
+
+IndexedStateTreeWriter::IndexedStateTreeWriter(const std::string& fileName_)
+	: out(fileName_, std::ios::binary), fileName(fileName_), header{}, position(sizeof(header)) {
+
+	// Заголовок перезаписывается в Close, 
+	// когда известны счётчики и положение таблицы
+
+	if (!out) {
+		throw std::runtime_error("Failed to open StateTree file: " + fileName);
+	}
+	std::memcpy(header.magic, kIndexedStateTreeMagic, sizeof(header.magic));
+	header.version = kIndexedStateTreeVersion;
+	header.counterBytes = sizeof(TreeCounter);
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+IndexedStateTreeWriter::~IndexedStateTreeWriter() {
+	if (out.is_open()) {
+		try {
+			Close();
+		}
+		catch (...) {
+		}
+	}
+}
+
+void IndexedStateTreeWriter::Add(int key, const StateTree& infoState) {
+	std::ostringstream subtree(std::ios::binary);
+	infoState.saveToBinary(subtree);
+	std::string bytes = subtree.str();
+
+	IndexedStateTreeEntry entry{};
+	entry.key = key;
+	entry.offset = position;
+	index.push_back(entry);
+	buffer += bytes;
+	position += bytes.size();
+
+	header.winFirstPlayerSum += infoState.winFirstPlayerSum;
+	header.winSecondPlayerSum += infoState.winSecondPlayerSum;
+	header.equalResultsSum += infoState.equalResultsSum;
+}
+
+void IndexedStateTreeWriter::Flush() {
+	out.write(buffer.data(), buffer.size());
+	buffer.clear();
+	buffer.shrink_to_fit();
+	if (!out) {
+		throw std::runtime_error("Failed to write StateTree file: " + fileName);
+	}
+}
+
+void IndexedStateTreeWriter::Close() {
+	Flush();
+	std::sort(index.begin(), index.end(),
+		[](const IndexedStateTreeEntry& a, const IndexedStateTreeEntry& b) {
+			return a.key < b.key;
+		});
+	header.numStates = index.size();
+	header.indexOffset = position;
+	out.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(IndexedStateTreeEntry));
+	out.seekp(0);
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	out.close();
+	if (!out) {
+		throw std::runtime_error("Failed to write StateTree file: " + fileName);
+	}
+}
+
+IndexedStateTreeFile::IndexedStateTreeFile(const std::string& fileName_)
+	: in(fileName_, std::ios::binary), fileName(fileName_), header{} {
+	in.read(reinterpret_cast<char*>(&header), sizeof(header));
+	if (!in || std::memcmp(header.magic, kIndexedStateTreeMagic, sizeof(header.magic)) != 0
+		|| header.version != kIndexedStateTreeVersion
+		|| header.counterBytes != sizeof(TreeCounter)) {
+		throw std::runtime_error("Invalid StateTree file: " + fileName);
+	}
+
+	index.resize(header.numStates);
+	in.seekg(header.indexOffset);
+	in.read(reinterpret_cast<char*>(index.data()), index.size() * sizeof(IndexedStateTreeEntry));
+	if (!in) {
+		throw std::runtime_error("Invalid StateTree file: " + fileName);
+	}
+}
+
+bool IndexedStateTreeFile::IsIndexedFile(const std::string& fileName) {
+	char magic[sizeof(kIndexedStateTreeMagic)] = {};
+	std::ifstream file(fileName, std::ios::binary);
+	file.read(magic, sizeof(magic));
+	return file && std::memcmp(magic, kIndexedStateTreeMagic, sizeof(magic)) == 0;
+}
+
+std::vector<int> IndexedStateTreeFile::Keys() const {
+	std::vector<int> keys;
+	keys.reserve(index.size());
+	for (const auto& entry : index) {
+		keys.push_back(entry.key);
+	}
+	return keys;
+}
+
+std::unique_ptr<StateTree> IndexedStateTreeFile::LoadSubtree(int key) {
+
+	// Поиск смещения поддерева по таблице и чтение только его
+
+	auto it = std::lower_bound(index.begin(), index.end(), key,
+		[](const IndexedStateTreeEntry& entry, int value) {
+			return entry.key < value;
+		});
+	if (it == index.end() || it->key != key) {
+		throw std::invalid_argument("Invalid state key!");
+	}
+
+	auto infoState = std::make_unique<StateTree>();
+	in.clear();
+	in.seekg(it->offset);
+	infoState->loadFromBinary(in);
+	if (!in) {
+		throw std::runtime_error("Failed to load StateTree from file: " + fileName);
+	}
+	return infoState;
+}
+
+//////////////////////////////////////BalanceClassifier/////////////////////////////////////////
+
+BalanceClassifier::BalanceClassifier(const BalanceBandSpec& spec_) : spec(spec_) {
+
+	// Названия подмножеств строятся один раз, 
+	// в порядке номеров подмножеств
+
+	if (spec.edges.empty() || !(spec.edges[0] > 0)
+		|| std::adjacent_find(spec.edges.begin(), spec.edges.end(), 
+			std::greater_equal<double>()) != spec.edges.end()) {
+		throw std::invalid_argument("Balance band edges must be positive and increasing!");
+	}
+
+	names.push_back(FormatName("equal", 0, spec.drawThreshold));
+	for (const char* side : { "firstPlayer", "secondPlayer" }) {
+		for (int band = 1; band <= BandsNum(); band++) {
+			names.push_back(FormatName(side, band == 1 ? 0 : spec.edges[band - 1], spec.edges[band]));
+		}
+	}
+	names.push_back(FormatName("equal", spec.drawThreshold, 1));
+	names.push_back(FormatName("firstPlayer", spec.edges.back(), 1));
+	names.push_back(FormatName("secondPlayer", spec.edges.back(), 1));
+
+	if (std::set<std::string>(names.begin(), names.end()).size() != names.size()) {
+		throw std::invalid_argument("Balance band names must be unique!");
+	}
+}
+
+std::string BalanceClassifier::FormatName(const std::string& side, double low, double high) const {
+
+	// Границы записываются в процентах: 0.05 -> 5
+
+	auto percent = [](double value) {
+		std::ostringstream out;
+		out << std::round(value * 10000) / 100;
+		return out.str();
+	};
+
+	std::string name = spec.namePattern;
+	for (const auto& [field, value] : { 
+		std::make_pair(std::string("{side}"), side), 
+		std::make_pair(std::string("{low}"), percent(low)), 
+		std::make_pair(std::string("{high}"), percent(high)) }) {
+		for (size_t pos = name.find(field); pos != std::string::npos; pos = name.find(field, pos + value.size())) {
+			name.replace(pos, field.size(), value);
+		}
+	}
+	return name;
+}
+
+int BalanceClassifier::BandBucket(double diff) const {
+
+	// Полоса (edges[band - 1], edges[band]], в которую попадает diff >= edges[0].
+	// Граница edges[0] относится к первой полосе, 
+	// 0 - diff больше последней границы
+
+	auto it = std::lower_bound(spec.edges.begin(), spec.edges.end(), diff);
+	if (it == spec.edges.end()) {
+		return 0;
+	}
+	return std::max(1, static_cast<int>(it - spec.edges.begin()));
+}
+
+int BalanceClassifier::Classify(OutcomeCounter winFirstPlayer, OutcomeCounter winSecondPlayer, OutcomeCounter equalResults) const {
+	double allRez = static_cast<double>(winFirstPlayer) + winSecondPlayer + equalResults;
+	if (allRez == 0) {
+		return 0;
+	}
+	double equalResultsPercent = equalResults / allRez;
+
+	// Разница между победами игроков 
+	// в процентном соотношении
+	double diff = winFirstPlayer / allRez - winSecondPlayer / allRez;
+
+	int bandsNum = BandsNum();
+	if (abs(diff) < spec.edges[0]) {
+		return equalResultsPercent < spec.drawThreshold ? 0 : 2 * bandsNum + 1;
+	}
+	if (diff > 0) {
+		int band = BandBucket(diff);
+		return band ? band : 2 * bandsNum + 2;
+	}
+	int band = BandBucket(-diff);
+	return band ? bandsNum + band : 2 * bandsNum + 3;
+}
+
+
+//////////////////////////////////////BoardSummary/////////////////////////////////////////
+
+BoardSummaryWriter::BoardSummaryWriter(const std::string& fileName_) : fileName(fileName_) {}
+
+void BoardSummaryWriter::Restore(uint64_t rowsNum) {
+
+	// Временный файл перезаписывается восстановленными строками: 
+	// строки после контрольной точки могли быть записаны не полностью
+
+	rows.assign(rowsNum, BoardSummary());
+	if (rowsNum > 0) {
+		std::ifstream in(fileName + ".rows", std::ios::binary);
+		in.read(reinterpret_cast<char*>(rows.data()), rowsNum * sizeof(BoardSummary));
+		if (!in) {
+			throw std::runtime_error("Failed to restore board summary: " + fileName);
+		}
+	}
+
+	rowsOut.open(fileName + ".rows", std::ios::binary | std::ios::trunc);
+	rowsOut.write(reinterpret_cast<const char*>(rows.data()), rows.size() * sizeof(BoardSummary));
+}
+
+void BoardSummaryWriter::Add(int action, const StateTree& infoState) {
+	BoardSummary row{ action, infoState.winFirstPlayerSum, 
+		infoState.winSecondPlayerSum, infoState.equalResultsSum };
+	rows.push_back(row);
+	rowsOut.write(reinterpret_cast<const char*>(&row), sizeof(row));
+}
+
+void BoardSummaryWriter::Flush() {
+	rowsOut.flush();
+	if (!rowsOut) {
+		throw std::runtime_error("Failed to write board summary: " + fileName);
+	}
+}
+
+void BoardSummaryWriter::Close() {
+
+	// Строки раскладываются по столбцам, 
+	// индекс order сортируется по diff
+
+	std::vector<uint32_t> order(rows.size());
+	std::vector<double> diffs(rows.size());
+	for (uint32_t i = 0; i < rows.size(); i++) {
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+		return rows[a].Diff() < rows[b].Diff();
+	});
+	for (size_t i = 0; i < order.size(); i++) {
+		diffs[i] = rows[order[i]].Diff();
+	}
+
+	BoardSummaryHeader header{};
+	std::memcpy(header.magic, kBoardSummaryMagic, sizeof(header.magic));
+	header.version = kBoardSummaryVersion;
+	header.counterBytes = sizeof(TreeCounter);
+	header.rowsNum = rows.size();
+
+	std::ofstream out(fileName, std::ios::binary);
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	std::vector<int> actions(rows.size());
+	for (size_t i = 0; i < rows.size(); i++) {
+		actions[i] = rows[i].action;
+	}
+	out.write(reinterpret_cast<const char*>(actions.data()), actions.size() * sizeof(int));
+	for (TreeCounter BoardSummary::* column : { &BoardSummary::winFirstPlayerSum, 
+		&BoardSummary::winSecondPlayerSum, &BoardSummary::equalResultsSum }) {
+		std::vector<TreeCounter> values(rows.size());
+		for (size_t i = 0; i < rows.size(); i++) {
+			values[i] = rows[i].*column;
+		}
+		out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(TreeCounter));
+	}
+	out.write(reinterpret_cast<const char*>(diffs.data()), diffs.size() * sizeof(double));
+	out.write(reinterpret_cast<const char*>(order.data()), order.size() * sizeof(uint32_t));
+	out.close();
+	if (!out) {
+		throw std::runtime_error("Failed to write board summary: " + fileName);
+	}
+
+	rowsOut.close();
+	std::remove((fileName + ".rows").c_str());
+}
+
+BoardSummaryFile::BoardSummaryFile(const std::string& fileName) {
+	std::ifstream in(fileName, std::ios::binary);
+	BoardSummaryHeader header{};
+	in.read(reinterpret_cast<char*>(&header), sizeof(header));
+	if (!in || std::memcmp(header.magic, kBoardSummaryMagic, sizeof(header.magic)) != 0
+		|| header.version != kBoardSummaryVersion
+		|| header.counterBytes != sizeof(TreeCounter)) {
+		throw std::runtime_error("Invalid board summary file: " + fileName);
+	}
+
+	size_t rowsNum = header.rowsNum;
+	actions.resize(rowsNum);
+	in.read(reinterpret_cast<char*>(actions.data()), rowsNum * sizeof(int));
+	for (std::vector<TreeCounter>* column : { &winFirstPlayerSum, &winSecondPlayerSum, &equalResultsSum }) {
+		column->resize(rowsNum);
+		in.read(reinterpret_cast<char*>(column->data()), rowsNum * sizeof(TreeCounter));
+	}
+	diffs.resize(rowsNum);
+	in.read(reinterpret_cast<char*>(diffs.data()), rowsNum * sizeof(double));
+	order.resize(rowsNum);
+	in.read(reinterpret_cast<char*>(order.data()), rowsNum * sizeof(uint32_t));
+	if (!in) {
+		throw std::runtime_error("Invalid board summary file: " + fileName);
+	}
+}
+
+bool BoardSummaryFile::IsSummaryFile(const std::string& fileName) {
+	char magic[sizeof(kBoardSummaryMagic)] = {};
+	std::ifstream file(fileName, std::ios::binary);
+	file.read(magic, sizeof(magic));
+	return file && std::memcmp(magic, kBoardSummaryMagic, sizeof(magic)) == 0;
+}
+
+BoardSummary BoardSummaryFile::Row(size_t row) const {
+	return BoardSummary{ actions[row], winFirstPlayerSum[row], 
+		winSecondPlayerSum[row], equalResultsSum[row] };
+}
+
+std::vector<BoardSummary> BoardSummaryFile::Band(double low, double high) const {
+
+	// Двоичный поиск границ полосы по отсортированным diffs
+
+	auto first = std::upper_bound(diffs.begin(), diffs.end(), low);
+	auto last = std::upper_bound(first, diffs.end(), high);
+
+	std::vector<BoardSummary> band;
+	band.reserve(last - first);
+	for (auto it = first; it != last; ++it) {
+		band.push_back(Row(order[it - diffs.begin()]));
+	}
+	return band;
+}
+
+std::vector<std::vector<int>> BoardSummaryFile::Rebucket(const BalanceClassifier& classifier) const {
+	std::vector<std::vector<int>> buckets(classifier.BucketsNum());
+	for (size_t row = 0; row < RowsNum(); row++) {
+		int bucket = classifier.Classify(winFirstPlayerSum[row], 
+			winSecondPlayerSum[row], equalResultsSum[row]);
+		buckets[bucket].push_back(actions[row]);
+	}
+	return buckets;
+}
+
+
+//////////////////////////////////////SubsetCheckpoint/////////////////////////////////////////
+
+void SubsetCheckpoint::Save(const std::string& fileName) const {
+
+	// Текстовый формат: по строке на поле, 
+	// затем счётчики подмножеств и записанные файлы
+
+	std::string tempFileName = fileName + ".tmp";
+	std::ofstream out(tempFileName);
+	out << "outcomes " << outcomesNum << "\n"
+		<< "slices " << slicesNum << "\n"
+		<< "next " << nextOutcome << "\n"
+		<< "subsets " << subsets.size() << "\n";
+	for (const auto& totals : subsets) {
+		out << totals.statesNum << " " << totals.winFirstPlayerSum << " " 
+			<< totals.winSecondPlayerSum << " " << totals.equalResultsSum << " " 
+			<< totals.name << "\n";
+	}
+	out << "files " << files.size() << "\n";
+	for (const auto& file : files) {
+		out << file << "\n";
+	}
+	out.close();
+	if (!out) {
+		throw std::runtime_error("Failed to write checkpoint: " + tempFileName);
+	}
+
+	// std::rename не заменяет существующий файл в Windows
+	std::remove(fileName.c_str());
+	if (std::rename(tempFileName.c_str(), fileName.c_str()) != 0) {
+		throw std::runtime_error("Failed to write checkpoint: " + fileName);
+	}
+}
+
+bool SubsetCheckpoint::Load(const std::string& fileName) {
+
+	// Если сбой произошёл между удалением старой 
+	// точки и переименованием, читается временный файл
+
+	std::ifstream in(fileName);
+	if (!in) {
+		in.open(fileName + ".tmp");
+		if (!in) {
+			return false;
+		}
+	}
+
+	std::string field;
+	size_t subsetsNum = 0, filesNum = 0;
+	in >> field >> outcomesNum >> field >> slicesNum 
+		>> field >> nextOutcome >> field >> subsetsNum;
+	subsets.assign(subsetsNum, Totals());
+	for (auto& totals : subsets) {
+		in >> totals.statesNum >> totals.winFirstPlayerSum 
+			>> totals.winSecondPlayerSum >> totals.equalResultsSum >> std::ws;
+		std::getline(in, totals.name);
+	}
+	in >> field >> filesNum;
+	files.assign(filesNum, std::string());
+	std::getline(in, field);
+	for (auto& file : files) {
+		std::getline(in, file);
+	}
+	if (!in) {
+		throw std::runtime_error("Failed to read checkpoint: " + fileName);
+	}
+	return true;
+}
+
+
+//////////////////////////////////////FlatStateTree/////////////////////////////////////////
+
+FlatStateTree::FileHeader FlatStateTree::MakeHeader(
+	uint32_t nodesNum_, uint32_t levelsNum_, uint64_t start) {
+
+	// Порядок массивов: три счётчика исходов (первыми, 
+	// чтобы 64-битные счётчики были выровнены), ключи, 
+	// начала дочерних узлов (nodesNum + 1), начала глубин (levelsNum + 1)
+
+	FileHeader header{};
+	std::memcpy(header.magic, kFileMagic, sizeof(header.magic));
+	header.version = kFileVersion;
+	header.nodesNum = nodesNum_;
+	header.levelsNum = levelsNum_;
+	header.counterBytes = sizeof(TreeCounter);
+
+	uint64_t counters = uint64_t(nodesNum_) * sizeof(TreeCounter);
+	uint64_t column = uint64_t(nodesNum_) * sizeof(uint32_t);
+	header.winFirstPlayerSumOffset = start;
+	header.winSecondPlayerSumOffset = header.winFirstPlayerSumOffset + counters;
+	header.equalResultsSumOffset = header.winSecondPlayerSumOffset + counters;
+	header.keysOffset = header.equalResultsSumOffset + counters;
+	header.childOffsetsOffset = header.keysOffset + column;
+	header.levelOffsetsOffset = header.childOffsetsOffset + column + sizeof(uint32_t);
+	header.fileSize = header.levelOffsetsOffset + (uint64_t(levelsNum_) + 1) * sizeof(uint32_t);
+	return header;
+}
+
+void FlatStateTree::SetSections(const char* base, const FileHeader& header) {
+	nodesNum = header.nodesNum;
+	levelsNum = header.levelsNum;
+	keys = reinterpret_cast<const int*>(base + header.keysOffset);
+	winFirstPlayerSum = reinterpret_cast<const TreeCounter*>(base + header.winFirstPlayerSumOffset);
+	winSecondPlayerSum = reinterpret_cast<const TreeCounter*>(base + header.winSecondPlayerSumOffset);
+	equalResultsSum = reinterpret_cast<const TreeCounter*>(base + header.equalResultsSumOffset);
+	childOffsets = reinterpret_cast<const uint32_t*>(base + header.childOffsetsOffset);
+	levelOffsets = reinterpret_cast<const uint32_t*>(base + header.levelOffsetsOffset);
+}
+
+std::unique_ptr<FlatStateTree> FlatStateTree::FromLevels(std::vector<Levels>& parts) {
+
+	// Узлы глубины depth - узлы глубины depth всех частей по порядку.
+	// Дочерние узлы идут в порядке родителей, поэтому начало 
+	// дочерних узлов очередного узла - накопленная сумма childrenNum
+
+	size_t levelsNum_ = 0;
+	for (const auto& part : parts) {
+		for (size_t depth = part.size(); depth > levelsNum_; depth--) {
+			if (!part[depth - 1].keys.empty()) {
+				levelsNum_ = depth;
+				break;
+			}
+		}
+	}
+	std::vector<size_t> levelSizes(levelsNum_, 0);
+	for (const auto& part : parts) {
+		for (size_t depth = 0; depth < part.size(); depth++) {
+			levelSizes[depth] += part[depth].keys.size();
+		}
+	}
+	size_t nodesNum_ = 0;
+	for (size_t levelSize : levelSizes) {
+		nodesNum_ += levelSize;
+	}
+	if (nodesNum_ >= UINT32_MAX) {
+		throw std::runtime_error("FlatStateTree: too many nodes");
+	}
+
+	// Массивы размечаются в arena так же, как в файле
+	FileHeader header = MakeHeader(static_cast<uint32_t>(nodesNum_), static_cast<uint32_t>(levelsNum_), 0);
+	auto tree = std::make_unique<FlatStateTree>();
+	tree->arena.resize((header.fileSize + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+	char* base = reinterpret_cast<char*>(tree->arena.data());
+	int* keys_ = reinterpret_cast<int*>(base + header.keysOffset);
+	TreeCounter* winFirst = reinterpret_cast<TreeCounter*>(base + header.winFirstPlayerSumOffset);
+	TreeCounter* winSecond = reinterpret_cast<TreeCounter*>(base + header.winSecondPlayerSumOffset);
+	TreeCounter* equal = reinterpret_cast<TreeCounter*>(base + header.equalResultsSumOffset);
+	uint32_t* childOffsets_ = reinterpret_cast<uint32_t*>(base + header.childOffsetsOffset);
+	uint32_t* levelOffsets_ = reinterpret_cast<uint32_t*>(base + header.levelOffsetsOffset);
+
+	size_t node = 0;
+	size_t nextChild = levelsNum_ > 0 ? levelSizes[0] : 0;
+	for (size_t depth = 0; depth < levelsNum_; depth++) {
+		levelOffsets_[depth] = static_cast<uint32_t>(node);
+		for (auto& part : parts) {
+			if (depth >= part.size()) {
+				continue;
+			}
+			Level& level = part[depth];
+			for (size_t i = 0; i < level.keys.size(); i++, node++) {
+				keys_[node] = level.keys[i];
+				winFirst[node] = level.winFirstPlayerSum[i];
+				winSecond[node] = level.winSecondPlayerSum[i];
+				equal[node] = level.equalResultsSum[i];
+				childOffsets_[node] = static_cast<uint32_t>(nextChild);
+				nextChild += level.childrenNum[i];
+			}
+			level = Level();
+		}
+	}
+	childOffsets_[nodesNum_] = static_cast<uint32_t>(nodesNum_);
+	levelOffsets_[levelsNum_] = static_cast<uint32_t>(nodesNum_);
+
+	tree->SetSections(base, header);
+	return tree;
+}
+
+static void AppendTreeLevels(const StateTree& infoState, int key, size_t depth, FlatStateTree::Levels& levels) {
+
+	// Узлы обычного дерева раскладываются по глубинам в порядке обхода в глубину
+
+	if (levels.size() <= depth) {
+		levels.resize(depth + 1);
+	}
+	size_t index = levels[depth].Add(key);
+	levels[depth].winFirstPlayerSum[index] = infoState.winFirstPlayerSum;
+	levels[depth].winSecondPlayerSum[index] = infoState.winSecondPlayerSum;
+	levels[depth].equalResultsSum[index] = infoState.equalResultsSum;
+	levels[depth].childrenNum[index] = static_cast<uint32_t>(infoState.states.size());
+
+	for (const auto& [childKey, child] : infoState.states) {
+		AppendTreeLevels(*child, childKey, depth + 1, levels);
+	}
+}
+
+std::unique_ptr<FlatStateTree> FlatStateTree::FromTree(const StateTree& infoState) {
+	std::vector<Levels> parts(1);
+	AppendTreeLevels(infoState, -1, 0, parts[0]);
+	return FromLevels(parts);
+}
+
+void FlatStateTree::SaveToFile(const std::string& fileName) const {
+
+	// Массивы записываются подряд сразу после заголовка
+
+	std::ofstream out(fileName, std::ios::binary);
+	if (!out) {
+		throw std::runtime_error("Failed to open FlatStateTree file: " + fileName);
+	}
+	FileHeader header = MakeHeader(nodesNum, levelsNum, sizeof(FileHeader));
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	out.write(reinterpret_cast<const char*>(winFirstPlayerSum), nodesNum * sizeof(TreeCounter));
+	out.write(reinterpret_cast<const char*>(winSecondPlayerSum), nodesNum * sizeof(TreeCounter));
+	out.write(reinterpret_cast<const char*>(equalResultsSum), nodesNum * sizeof(TreeCounter));
+	out.write(reinterpret_cast<const char*>(keys), nodesNum * sizeof(int));
+	out.write(reinterpret_cast<const char*>(childOffsets), (size_t(nodesNum) + 1) * sizeof(uint32_t));
+	out.write(reinterpret_cast<const char*>(levelOffsets), (size_t(levelsNum) + 1) * sizeof(uint32_t));
+	if (!out) {
+		throw std::runtime_error("Failed to write FlatStateTree file: " + fileName);
+	}
+}
+
+bool FlatStateTree::IsFlatTreeFile(const std::string& fileName) {
+	char magic[sizeof(kFileMagic)] = {};
+	std::ifstream in(fileName, std::ios::binary);
+	in.read(magic, sizeof(magic));
+	return in && std::memcmp(magic, kFileMagic, sizeof(magic)) == 0;
+}
+
+std::unique_ptr<FlatStateTree> FlatStateTree::MapFile(const std::string& fileName) {
+
+	// Файл отображается только для чтения, 
+	// отображение живёт, пока живёт дерево
+
+	auto tree = std::make_unique<FlatStateTree>();
+	uint64_t fileSize = 0;
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, 
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		throw std::runtime_error("Failed to open FlatStateTree file: " + fileName);
+	}
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart < LONGLONG(sizeof(FileHeader))) {
+		CloseHandle(file);
+		throw std::runtime_error("Invalid FlatStateTree file: " + fileName);
+	}
+	fileSize = size.QuadPart;
+	HANDLE fileMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!fileMapping) {
+		throw std::runtime_error("Failed to map FlatStateTree file: " + fileName);
+	}
+	const void* data = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(fileMapping);
+	if (!data) {
+		throw std::runtime_error("Failed to map FlatStateTree file: " + fileName);
+	}
+	tree->mapping = std::shared_ptr<const void>(data, [](const void* view) {
+		UnmapViewOfFile(view);
+	});
+#else
+	int file = open(fileName.c_str(), O_RDONLY);
+	if (file < 0) {
+		throw std::runtime_error("Failed to open FlatStateTree file: " + fileName);
+	}
+	struct stat fileStat;
+	if (fstat(file, &fileStat) != 0 || fileStat.st_size < off_t(sizeof(FileHeader))) {
+		close(file);
+		throw std::runtime_error("Invalid FlatStateTree file: " + fileName);
+	}
+	fileSize = fileStat.st_size;
+	void* data = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, file, 0);
+	close(file);
+	if (data == MAP_FAILED) {
+		throw std::runtime_error("Failed to map FlatStateTree file: " + fileName);
+	}
+	size_t mappedSize = fileSize;
+	tree->mapping = std::shared_ptr<const void>(data, [mappedSize](const void* view) {
+		munmap(const_cast<void*>(view), mappedSize);
+	});
+#endif
+
+	// Проверка заголовка: все массивы должны лежать внутри файла
+	const char* base = static_cast<const char*>(tree->mapping.get());
+	FileHeader header;
+	std::memcpy(&header, base, sizeof(header));
+	FileHeader expected = MakeHeader(header.nodesNum, header.levelsNum, header.winFirstPlayerSumOffset);
+	if (std::memcmp(&header, &expected, sizeof(header)) != 0
+		|| header.winFirstPlayerSumOffset < sizeof(FileHeader)
+		|| header.winFirstPlayerSumOffset % sizeof(TreeCounter) != 0
+		|| header.fileSize > fileSize) {
+		throw std::runtime_error("Invalid FlatStateTree file: " + fileName);
+	}
+	tree->SetSections(base, header);
+	return tree;
+}
+
+std::vector<int> FlatStateTree::PathTo(uint32_t node) const {
+
+	// Дети узлов одной глубины идут подряд, поэтому родитель - 
+	// последний узел предыдущей глубины, у которого смещение 
+	// детей не больше номера узла. У корня ключа действия нет
+
+	if (node >= nodesNum) {
+		throw std::out_of_range("FlatStateTree node out of range");
+	}
+	int depth = static_cast<int>(
+		std::upper_bound(levelOffsets, levelOffsets + levelsNum + 1, node) - levelOffsets) - 1;
+
+	std::vector<int> path(depth);
+	for (; depth > 0; depth--) {
+		path[depth - 1] = keys[node];
+		const uint32_t* first = childOffsets + LevelBegin(depth - 1);
+		const uint32_t* last = childOffsets + LevelEnd(depth - 1);
+		node = static_cast<uint32_t>(std::upper_bound(first, last, node) - childOffsets) - 1;
+	}
+	return path;
+}
+
+//////////////////////////////////////StateOutcomesTree/////////////////////////////////////////
+
+std::unique_ptr<StateTree> StateOutcomesTree::InitialStateTree(
+	StateTraversal& traversal, int depth) {
+
+	// Создание и заполнение дерева исходов.
+	// Обход идет по одному состоянию: ход применяется 
+	// перед спуском в поддерево и отменяется после
+
+	open_spiel::State& state_ = traversal.GetState();
+
+	if (state_.IsTerminal()) {
+		// Добавление соотвествующего исхода в терминальном состоянии игры
+		std::unique_ptr<StateTree> infoState = std::make_unique<StateTree>();
+		auto result = traversal.FirstPlayerResult();
+		if (result > 0) {
+			// Победа первого игрока
+			infoState->winFirstPlayerSum = 1;
+			infoState->winSecondPlayerSum = 0;
+			infoState->equalResultsSum = 0;
+		}
+		else if (result < 0) {
+			// Победа второго игрока
+			infoState->winFirstPlayerSum = 0;
+			infoState->winSecondPlayerSum = 1;
+			infoState->equalResultsSum = 0;
+		}
+		else {
+			// Ничья
+			infoState->winFirstPlayerSum = 0;
+			infoState->winSecondPlayerSum = 0;
+			infoState->equalResultsSum = 1;
+		}
+		return std::move(infoState);
+	}
+
+	// Создание узла для текущего состояния, обход всех его дочерних узлов, 
+	// и сохранение количества потенциальных исходов из них
+	open_spiel::Player player = state_.CurrentPlayer();
+	int actionsNum;
+	const open_spiel::Action* actions = traversal.LegalActions(depth, actionsNum);
+	if (depth == 0) {
+		traversal.PrepareBonusBounds(actions, actionsNum);
+	}
+
+	// Исход решённой позиции известен, 
+	// ходы по состоянию игры не нужны
+	int result;
+	if (traversal.DecidedResult(actions, actionsNum, result)) {
+		return DecidedStateTree(traversal, actions, actionsNum, result);
+	}
+
+	std::unique_ptr<StateTree> infoState = std::make_unique<StateTree>();
+	for (int i = 0; i < actionsNum; i++) {
+		open_spiel::Action action_ = actions[i];
+		state_.ApplyAction(action_);
+		std::unique_ptr<StateTree> child = InitialStateTree(traversal, depth + 1);
+		state_.UndoAction(player, action_);
+
+		infoState->winFirstPlayerSum += child->winFirstPlayerSum;
+		infoState->winSecondPlayerSum += child->winSecondPlayerSum;
+		infoState->equalResultsSum += child->equalResultsSum;
+		infoState->states[action_] = std::move(child);
+	}
+	return std::move(infoState);
+}
+
+std::unique_ptr<StateTree> StateOutcomesTree::DecidedStateTree(
+	const StateTraversal& traversal, const open_spiel::Action* actions, int actionsNum, int result) {
+
+	// Дерево совпадает с полным обходом: те же ключи действий 
+	// на каждой глубине, в каждом узле все actionsNum! 
+	// конечных состояний поддерева дают исход result
+
+	std::unique_ptr<StateTree> infoState = std::make_unique<StateTree>();
+	TreeCounter leavesNum = ToTreeCounter(traversal.OrdersNum(actionsNum));
+	if (result > 0) {
+		infoState->winFirstPlayerSum = leavesNum;
+	}
+	else if (result < 0) {
+		infoState->winSecondPlayerSum = leavesNum;
+	}
+	else {
+		infoState->equalResultsSum = leavesNum;
+	}
+
+	// Оставшиеся действия дочернего узла - все, кроме выбранного
+	open_spiel::Action restActions[StateTraversal::kMaxDecidedMovesNum];
+	for (int i = 0; i < actionsNum; i++) {
+		std::copy(actions, actions + i, restActions);
+		std::copy(actions + i + 1, actions + actionsNum, restActions + i);
+		infoState->states[actions[i]] = DecidedStateTree(traversal, restActions, actionsNum - 1, result);
+	}
+	return infoState;
+}
+
+void StateOutcomesTree::FindStateTree(std::unique_ptr<open_spiel::State> state_) {
+
+	// Внешняя функция к созданию и наполнению дерева исходов
+	if (state_->IsChanceNode()) {
+
+		infoStateTree = std::make_unique<StateTree>();///////////
+	
+		std::vector<std::pair<open_spiel::Action, double>> outcomes =
+			state_->ChanceOutcomes();
+
+		// Корень суммирует исходы всех начальных состояний, 
+		// суммы считаются в 64 битах и проверяются
+		OutcomeCounter winFirst = 0, winSecond = 0, equal = 0;
+		StateTraversal traversal(*state_);
+		for (auto action_ : outcomes) {
+			state_->ApplyAction(action_.first);
+			infoStateTree->states[action_.first] = InitialStateTree(traversal, 0);
+			state_->UndoAction(open_spiel::kChancePlayerId, action_.first);
+
+			winFirst += infoStateTree->states[action_.first]->winFirstPlayerSum;
+			winSecond += infoStateTree->states[action_.first]->winSecondPlayerSum;
+			equal += infoStateTree->states[action_.first]->equalResultsSum;
+		}
+		infoStateTree->winFirstPlayerSum = ToTreeCounter(winFirst);
+		infoStateTree->winSecondPlayerSum = ToTreeCounter(winSecond);
+		infoStateTree->equalResultsSum = ToTreeCounter(equal);
+	}
+	else {
+		StateTraversal traversal(*state_);
+		infoStateTree = InitialStateTree(traversal, 0);
+	}
+	
+}
+
+void StateOutcomesTree::FindStateTree(
+	std::unique_ptr<open_spiel::State> state_, unsigned threadsNum) {
+
+	// Многопоточное создание дерева исходов.
+	// Поддеревья начальных состояний (outcomes) строятся 
+	// независимо в пуле из threadsNum потоков, 
+	// после чего объединяются в порядке outcomes, 
+	// поэтому результат совпадает с однопоточным 
+	// при любом количестве потоков
+
+	if (threadsNum == 1 || !state_->IsChanceNode()) {
+		FindStateTree(std::move(state_));
+		return;
+	}
+
+	std::vector<std::pair<open_spiel::Action, double>> outcomes =
+		state_->ChanceOutcomes();
+
+	// Поддерево каждого начального состояния 
+	// записывается в свою ячейку, потоки не пересекаются.
+	// Каждая задача обходит свою копию состояния
+	std::vector<std::unique_ptr<StateTree>> subtrees(outcomes.size());
+	{
+		ThreadPool pool(threadsNum);
+		const open_spiel::State& chanceState = *state_;
+		for (size_t i = 0; i < outcomes.size(); i++) {
+			open_spiel::Action action = outcomes[i].first;
+			pool.Submit([this, &chanceState, &subtrees, action, i]() {
+				std::unique_ptr<open_spiel::State> state = chanceState.Child(action);
+				StateTraversal traversal(*state);
+				subtrees[i] = InitialStateTree(traversal, 0);
+			});
+		}
+		pool.Wait();
+	}
+
+	infoStateTree = std::make_unique<StateTree>();
+	OutcomeCounter winFirst = 0, winSecond = 0, equal = 0;
+	for (size_t i = 0; i < outcomes.size(); i++) {
+		winFirst += subtrees[i]->winFirstPlayerSum;
+		winSecond += subtrees[i]->winSecondPlayerSum;
+		equal += subtrees[i]->equalResultsSum;
+		infoStateTree->states[outcomes[i].first] = std::move(subtrees[i]);
+	}
+	infoStateTree->winFirstPlayerSum = ToTreeCounter(winFirst);
+	infoStateTree->winSecondPlayerSum = ToTreeCounter(winSecond);
+	infoStateTree->equalResultsSum = ToTreeCounter(equal);
+}
+
+std::unique_ptr<StateTree> StateOutcomesTree::GetTree() {
+
+	// Перенести дерево исходов для дальнейшего использования
+
+	return std::move(infoStateTree);
+}
+
+void StateOutcomesTree::SetTree(std::unique_ptr<StateTree> infoState) {
+
+	// Вернуть дерево исходов в объект
+
+	infoStateTree = std::move(infoState);
+}
+
+void StateOutcomesTree::Serialize(std::string fileName) {
+	//infoStateTree->saveToBinaryMMap(fileName);
+
+	std::cout << "Outcomes serialize...\n";
+	auto start = std::chrono::high_resolution_clock::now();
+
+	std::ofstream fout(fileName, std::ios::binary);
+	//archive(&fout) << &infoStateTree;
+	infoStateTree->saveToFile(fout);
+	fout.close();
+
+	auto end = std::chrono::high_resolution_clock::now();
+	// Вычисляем продолжительность
+	std::chrono::duration<double> duration = end - start;
+	std::cout << "Outcomes serialized. Time = " << duration.count() << " s.\n";
+}
+
+void StateOutcomesTree::Deserialize(std::string fileName) {
+	//infoStateTree->loadFromBinaryMMap(fileName);
+
+	std::cout << "Outcomes deserialize...\n";
+	auto start = std::chrono::high_resolution_clock::now();
+	
+	std::ifstream fin(fileName, std::ios::binary);
+	//archive(&fin) >> &infoStateTree;
+	infoStateTree->loadFromFile(fin, fileName);
+	fin.close();
+
+	auto end = std::chrono::high_resolution_clock::now();
+	// Вычисляем продолжительность
+	std::chrono::duration<double> duration = end - start;
+	std::cout << "Outcomes deserialized. Time = " << duration.count() << " s.\n";
+}
+
+uint32_t StateOutcomesTree::InitialStateGraph(
+	StateTraversal& traversal, int depth, StateGraphPositions& transpositions) {
+
+	// Создание графа исходов с общими поддеревьями.
+	// Исход позиции зависит только от содержимого клеток поля 
+	// и от того, чей ход, но не от порядка сделанных ходов, 
+	// поэтому уже вычисленная позиция не раскрывается повторно, 
+	// а переиспользуется её узел
+
+	open_spiel::State& state_ = traversal.GetState();
+	const MushroomGladeInterface* gladeState = traversal.GetGladeState();
+	GladePosition gladeKey{};
+	std::string positionKey;
+	if (gladeState) {
+		gladeKey = GladePosition{ 
+			gladeState->PlayerCells(0), gladeState->PlayerCells(1), state_.CurrentPlayer() };
+		auto found = transpositions.glade.find(gladeKey);
+		if (found != transpositions.glade.end()) {
+			return found->second;
+		}
+	}
+	else {
+		positionKey = std::to_string(state_.CurrentPlayer()) + ":" + state_.ToString();
+		auto found = transpositions.other.find(positionKey);
+		if (found != transpositions.other.end()) {
+			return found->second;
+		}
+	}
+
+	StateGraph::Node node;
+	std::vector<std::pair<int, uint32_t>> edges;
+
+	if (state_.IsTerminal()) {
+		// Добавление соотвествующего исхода в терминальном состоянии игры
+		auto result = traversal.FirstPlayerResult();
+		if (result > 0) {
+			node.winFirstPlayerSum = 1;
+		}
+		else if (result < 0) {
+			node.winSecondPlayerSum = 1;
+		}
+		else {
+			node.equalResultsSum = 1;
+		}
+	}
+	else {
+		open_spiel::Player player = state_.CurrentPlayer();
+		int actionsNum;
+		const open_spiel::Action* actions = traversal.LegalActions(depth, actionsNum);
+		for (int i = 0; i < actionsNum; i++) {
+			open_spiel::Action action_ = actions[i];
+			state_.ApplyAction(action_);
+			uint32_t child = InitialStateGraph(traversal, depth + 1, transpositions);
+			state_.UndoAction(player, action_);
+			edges.emplace_back(action_, child);
+			node.winFirstPlayerSum += 
+				infoStateGraph->nodes[child].winFirstPlayerSum;
+			node.winSecondPlayerSum += 
+				infoStateGraph->nodes[child].winSecondPlayerSum;
+			node.equalResultsSum += 
+				infoStateGraph->nodes[child].equalResultsSum;
+		}
+	}
+
+	// Переходы узла хранятся подряд в порядке возрастания действий,
+	// как ключи в StateTree::states
+	std::sort(edges.begin(), edges.end());
+	node.firstEdge = infoStateGraph->edgeActions.size();
+	node.edgesNum = edges.size();
+	for (const auto& [action, child] : edges) {
+		infoStateGraph->edgeActions.push_back(action);
+		infoStateGraph->edgeTargets.push_back(child);
+	}
+
+	infoStateGraph->nodes.push_back(node);
+	uint32_t index = infoStateGraph->nodes.size() - 1;
+	if (gladeState) {
+		transpositions.glade.emplace(gladeKey, index);
+	}
+	else {
+		transpositions.other.emplace(std::move(positionKey), index);
+	}
+	return index;
+}
+
+void StateOutcomesTree::FindStateGraph(std::unique_ptr<open_spiel::State> state_) {
+
+	// Внешняя функция к созданию графа исходов.
+	// Позиции разных начальных состояний (outcomes) не совпадают, 
+	// поэтому таблица позиций заводится для каждого из них отдельно 
+	// и память под неё не растёт с количеством начальных состояний
+
+	infoStateGraph = std::make_unique<StateGraph>();
+	StateGraphPositions transpositions;
+
+	if (state_->IsChanceNode()) {
+		std::vector<std::pair<open_spiel::Action, double>> outcomes =
+			state_->ChanceOutcomes();
+
+		std::vector<std::pair<int, uint32_t>> edges;
+		edges.reserve(outcomes.size());
+		StateGraph::Node root;
+		OutcomeCounter winFirst = 0, winSecond = 0, equal = 0;
+
+		StateTraversal traversal(*state_);
+		for (auto action_ : outcomes) {
+			transpositions.clear();
+			state_->ApplyAction(action_.first);
+			uint32_t child = InitialStateGraph(traversal, 0, transpositions);
+			state_->UndoAction(open_spiel::kChancePlayerId, action_.first);
+			edges.emplace_back(action_.first, child);
+			winFirst += infoStateGraph->nodes[child].winFirstPlayerSum;
+			winSecond += infoStateGraph->nodes[child].winSecondPlayerSum;
+			equal += infoStateGraph->nodes[child].equalResultsSum;
+		}
+		root.winFirstPlayerSum = ToTreeCounter(winFirst);
+		root.winSecondPlayerSum = ToTreeCounter(winSecond);
+		root.equalResultsSum = ToTreeCounter(equal);
+
+		root.firstEdge = infoStateGraph->edgeActions.size();
+		root.edgesNum = edges.size();
+		for (const auto& [action, child] : edges) {
+			infoStateGraph->edgeActions.push_back(action);
+			infoStateGraph->edgeTargets.push_back(child);
+		}
+		infoStateGraph->nodes.push_back(root);
+		infoStateGraph->root = infoStateGraph->nodes.size() - 1;
+	}
+	else {
+		StateTraversal traversal(*state_);
+		infoStateGraph->root = InitialStateGraph(traversal, 0, transpositions);
+	}
+}
+
+std::unique_ptr<StateGraph> StateOutcomesTree::GetGraph() {
+
+	// Перенести граф исходов для дальнейшего использования
+
+	return std::move(infoStateGraph);
+}
+
+void StateOutcomesTree::SerializeGraph(std::string fileName) {
+	std::cout << "Outcomes graph serialize...\n";
+	auto start = std::chrono::high_resolution_clock::now();
+
+	std::ofstream fout(fileName, std::ios::binary);
+	infoStateGraph->saveToBinary(fout);
+	fout.close();
+
+	auto end = std::chrono::high_resolution_clock::now();
+	// Вычисляем продолжительность
+	std::chrono::duration<double> duration = end - start;
+	std::cout << "Outcomes graph serialized. Time = " << duration.count() << " s.\n";
+}
+
+void StateOutcomesTree::DeserializeGraph(std::string fileName) {
+	std::cout << "Outcomes graph deserialize...\n";
+	auto start = std::chrono::high_resolution_clock::now();
+
+	std::ifstream fin(fileName, std::ios::binary);
+	infoStateGraph = std::make_unique<StateGraph>();
+	infoStateGraph->loadFromBinary(fin);
+	fin.close();
+
+	auto end = std::chrono::high_resolution_clock::now();
+	// Вычисляем продолжительность
+	std::chrono::duration<double> duration = end - start;
+	std::cout << "Outcomes graph deserialized. Time = " << duration.count() << " s.\n";
+}
+
+void StateOutcomesTree::InitialFlatStateTree(
+	StateTraversal& traversal, int depth, int key, FlatStateTree::Levels& levels) {
+
+	// Заполнение плоского дерева исходов по глубинам.
+	// Узел добавляется на свою глубину до обхода поддерева, 
+	// счётчики заполняются после. Ссылки на уровни 
+	// не сохраняются: levels может расти во время обхода
+
+	if (levels.size() <= static_cast<size_t>(depth) + 1) {
+		levels.resize(depth + 2);
+	}
+	size_t index = levels[depth].Add(key);
+
+	open_spiel::State& state_ = traversal.GetState();
+	if (state_.IsTerminal()) {
+		auto result = traversal.FirstPlayerResult();
+		if (result > 0) {
+			levels[depth].winFirstPlayerSum[index] = 1;
+		}
+		else if (result < 0) {
+			levels[depth].winSecondPlayerSum[index] = 1;
+		}
+		else {
+			levels[depth].equalResultsSum[index] = 1;
+		}
+		return;
+	}
+
+	open_spiel::Player player = state_.CurrentPlayer();
+	int actionsNum;
+	const open_spiel::Action* actions = traversal.LegalActions(depth, actionsNum);
+	for (int i = 0; i < actionsNum; i++) {
+		open_spiel::Action action_ = actions[i];
+		size_t child = levels[depth + 1].keys.size();
+
+		state_.ApplyAction(action_);
+		InitialFlatStateTree(traversal, depth + 1, static_cast<int>(action_), levels);
+		state_.UndoAction(player, action_);
+
+		const FlatStateTree::Level& children = levels[depth + 1];
+		levels[depth].winFirstPlayerSum[index] += children.winFirstPlayerSum[child];
+		levels[depth].winSecondPlayerSum[index] += children.winSecondPlayerSum[child];
+		levels[depth].equalResultsSum[index] += children.equalResultsSum[child];
+	}
+	levels[depth].childrenNum[index] = actionsNum;
+}
+
+void StateOutcomesTree::FindFlatStateTree(
+	std::unique_ptr<open_spiel::State> state_, unsigned threadsNum) {
+
+	// Создание плоского дерева исходов.
+	// Для случайного узла поддеревья начальных состояний 
+	// строятся по глубинам независимо (в пуле из threadsNum потоков) 
+	// и склеиваются в порядке outcomes под общим корнем
+
+	std::vector<FlatStateTree::Levels> parts;
+
+	if (!state_->IsChanceNode()) {
+		parts.resize(1);
+		StateTraversal traversal(*state_);
+		InitialFlatStateTree(traversal, 0, -1, parts[0]);
+		infoFlatTree = FlatStateTree::FromLevels(parts);
+		return;
+	}
+
+	std::vector<std::pair<open_spiel::Action, double>> outcomes =
+		state_->ChanceOutcomes();
+
+	// parts[0] - корень, parts[i + 1] - поддерево outcomes[i] с глубины 1
+	parts.resize(outcomes.size() + 1);
+	if (threadsNum == 1) {
+		StateTraversal traversal(*state_);
+		for (size_t i = 0; i < outcomes.size(); i++) {
+			state_->ApplyAction(outcomes[i].first);
+			InitialFlatStateTree(traversal, 1, static_cast<int>(outcomes[i].first), parts[i + 1]);
+			state_->UndoAction(open_spiel::kChancePlayerId, outcomes[i].first);
+		}
+	}
+	else {
+		ThreadPool pool(threadsNum);
+		const open_spiel::State& chanceState = *state_;
+		for (size_t i = 0; i < outcomes.size(); i++) {
+			open_spiel::Action action = outcomes[i].first;
+			pool.Submit([this, &chanceState, &parts, action, i]() {
+				std::unique_ptr<open_spiel::State> state = chanceState.Child(action);
+				StateTraversal traversal(*state);
+				InitialFlatStateTree(traversal, 1, static_cast<int>(action), parts[i + 1]);
+			});
+		}
+		pool.Wait();
+	}
+
+	FlatStateTree::Levels& root = parts[0];
+	root.resize(1);
+	root[0].Add(-1);
+	OutcomeCounter winFirst = 0, winSecond = 0, equal = 0;
+	for (size_t i = 1; i < parts.size(); i++) {
+		winFirst += parts[i][1].winFirstPlayerSum[0];
+		winSecond += parts[i][1].winSecondPlayerSum[0];
+		equal += parts[i][1].equalResultsSum[0];
+	}
+	root[0].winFirstPlayerSum[0] = ToTreeCounter(winFirst);
+	root[0].winSecondPlayerSum[0] = ToTreeCounter(winSecond);
+	root[0].equalResultsSum[0] = ToTreeCounter(equal);
+	root[0].childrenNum[0] = static_cast<uint32_t>(outcomes.size());
+
+	infoFlatTree = FlatStateTree::FromLevels(parts);
+}
+
+std::unique_ptr<FlatStateTree> StateOutcomesTree::GetFlatTree() {
+
+	// Перенести плоское дерево исходов для дальнейшего использования
+
+	return std::move(infoFlatTree);
+}
+
+void StateOutcomesTree::SerializeFlatTree(std::string fileName) {
+	std::cout << "Outcomes flat tree serialize...\n";
+	auto start = std::chrono::high_resolution_clock::now();
+
+	infoFlatTree->SaveToFile(fileName);
+
+	auto end = std::chrono::high_resolution_clock::now();
+	// Вычисляем продолжительность
+	std::chrono::duration<double> duration = end - start;
+	std::cout << "Outcomes flat tree serialized. Time = " << duration.count() << " s.\n";
+}
+
+void StateOutcomesTree::FindAndSerializeStateTree(
+	std::unique_ptr<open_spiel::State> state_, 
+	std::string gameName, std::string gameLength, 
+	std::string boardSize, std::string statisticFile,
+	std::string logFile, int slice_step, size_t bufferBytes, bool resume) {
+
+	// Функция вычисляет деревья исходов для всех 
+	// начальных состояний (outcomes) игры state_. 
+	// Каждое дерево исходов относится к определенному 
+	// подмножеству из subsets в зависимости от разницы 
+	// процентных соотношений побед игроков (diff).
+	// Все подмножества записываются в отдельные файлы, 
+	// информация о количестве исходов в каждом подмножестве 
+	// и об их соотношении записывается в файл statisticFile.
+	// Есть вариант разделения каждого подмножетсва 
+	// на slice_step равных частей, если в игре слишком много 
+	// начальных состояний и сами подмножества оказываются 
+	// слишком большими. Это нужно для более быстрой 
+	// загрузки/выгрузки файлов подмножеств.
+	// Деревья исходов не накапливаются в памяти: каждое 
+	// сразу дописывается в буфер файла своего подмножества, 
+	// общий размер буферов ограничен bufferBytes.
+	// Количества исходов каждого начального состояния 
+	// записываются в сводную таблицу gameName_summary.bin 
+	// (см. BoardSummaryFile).
+	// После записи каждой части сохраняется контрольная 
+	// точка gameName_checkpoint.txt. При resume уже записанные 
+	// части пропускаются, и генерация продолжается с первого 
+	// необработанного начального состояния.
+
+	// Проверка ялвяется ли состояние игры 
+	// случайным(начальным) узлом
+	if (state_->IsChanceNode()) {
+
+		// Берутся все начальные состояния игры
+		std::vector<std::pair<open_spiel::Action, double>> outcomes =
+			state_->ChanceOutcomes();
+
+		int bucketsNum = balanceClassifier.BucketsNum();
+
+		// Начальные состояния делятся на slicesNum частей,
+		// последняя часть забирает остаток от деления
+		int slicesNum = std::max(1, std::min(slice_step, static_cast<int>(outcomes.size())));
+		size_t slice = outcomes.size() / slicesNum;
+
+		std::string checkpointFile = gameName + "_checkpoint.txt";
+		SubsetCheckpoint checkpoint;
+		if (resume && checkpoint.Load(checkpointFile)) {
+			if (checkpoint.outcomesNum != outcomes.size() 
+				|| checkpoint.slicesNum != slicesNum 
+				|| checkpoint.subsets.size() != static_cast<size_t>(bucketsNum)) {
+				throw std::runtime_error("Checkpoint does not match the game: " + checkpointFile);
+			}
+			for (int i = 0; i < bucketsNum; i++) {
+				if (checkpoint.subsets[i].name != balanceClassifier.BucketName(i)) {
+					throw std::runtime_error("Checkpoint does not match the balance bands: " + checkpointFile);
+				}
+			}
+			std::ofstream out(logFile, std::ios::app);
+			out << "Resume from outcome " << checkpoint.nextOutcome 
+				<< " of " << checkpoint.outcomesNum << "\n";
+			out.close();
+		}
+		else {
+			checkpoint = SubsetCheckpoint();
+			checkpoint.outcomesNum = outcomes.size();
+			checkpoint.slicesNum = slicesNum;
+			checkpoint.subsets.resize(bucketsNum);
+			for (int i = 0; i < bucketsNum; i++) {
+				checkpoint.subsets[i].name = balanceClassifier.BucketName(i);
+			}
+
+			// Запись в файл информации о разных подмножествах 
+			// для дальнейшей обработки и представлении в виде таблицы
+			std::ofstream out;
+			out.open(statisticFile, std::ios::app);
+			std::cout << "Open log file for writting...\n";
+			out << "File_name;Strategies_count;Game_length;Board-size;" 
+				<< "First_player_wins_num;Second_player_wins_num;" 
+				<< "Equal_results_num;All_variants_num;" 
+				<< "First_player_wins_percent;Second_player_wins_percent;" 
+				<< "Equal_results_percent;\n";
+			out.close();
+		}
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		StateTraversal traversal(*state_);
+
+		// Сводная таблица дописывается только 
+		// если остались необработанные состояния
+		std::unique_ptr<BoardSummaryWriter> summary;
+		if (checkpoint.nextOutcome < outcomes.size()) {
+			summary = std::make_unique<BoardSummaryWriter>(gameName + "_summary.bin");
+			summary->Restore(checkpoint.nextOutcome);
+		}
+
+		// Файлы подмножеств текущей части. Дерево исходов 
+		// начального состояния сразу дописывается в буфер своего 
+		// подмножества, буферы сбрасываются на диск, когда их 
+		// общий размер превышает bufferBytes
+		std::vector<std::unique_ptr<IndexedStateTreeWriter>> subsets;
+		size_t bufferedBytes = 0;
+		int number = 0;
+
+		// Обрабатываются все ещё не записанные начальные состояния игры
+		for (size_t i = checkpoint.nextOutcome; i < outcomes.size(); i++) {
+
+			int part = static_cast<int>(std::min(i / slice, static_cast<size_t>(slicesNum - 1))) + 1;
+			if (part != number) {
+				// Запись подмножеств предыдущей части в файлы
+				// и сохранение контрольной точки
+				if (!subsets.empty()) {
+					CloseSubsetFiles(subsets, checkpoint, statisticFile, logFile, gameLength, boardSize);
+					summary->Flush();
+					checkpoint.nextOutcome = i;
+					checkpoint.Save(checkpointFile);
+				}
+
+				number = part;
+				for (int bucket = 0; bucket < bucketsNum; bucket++) {
+					subsets.push_back(std::make_unique<IndexedStateTreeWriter>(
+						std::to_string(number) + "_" + gameName 
+						+ balanceClassifier.BucketName(bucket)));
+				}
+				bufferedBytes = 0;
+			}
+
+			open_spiel::Action action_ = outcomes[i].first;
+			state_->ApplyAction(action_);
+			std::unique_ptr<StateTree> infoState = 
+				InitialStateTree(traversal, 0);
+			state_->UndoAction(open_spiel::kChancePlayerId, action_);
+
+			// Дерево исходов каждого начального состояния 
+			// относится ровно к одному из подмножеств
+			IndexedStateTreeWriter& writer = *subsets[balanceClassifier.Classify(*infoState)];
+			summary->Add(static_cast<int>(action_), *infoState);
+			size_t buffered = writer.BufferedBytes();
+			writer.Add(static_cast<int>(action_), *infoState);
+			bufferedBytes += writer.BufferedBytes() - buffered;
+
+			if (bufferedBytes > bufferBytes) {
+				for (auto& subsetWriter : subsets) {
+					subsetWriter->Flush();
+				}
+				bufferedBytes = 0;
+			}
+		}
+
+		// Запись подмножеств последней части
+		if (!subsets.empty()) {
+			CloseSubsetFiles(subsets, checkpoint, statisticFile, logFile, gameLength, boardSize);
+			summary->Close();
+			checkpoint.nextOutcome = outcomes.size();
+			checkpoint.Save(checkpointFile);
+		}
+
+		auto end = std::chrono::high_resolution_clock::now();
+		// Вычисляем продолжительность
+		std::chrono::duration<double> duration = end - start;
+		std::ofstream out1(logFile, std::ios::app);
+		out1 << "Outcomes counted. Time = " << duration.count() << " s.\n";
+		for (const auto& totals : checkpoint.subsets) {
+			out1 << gameName << totals.name << ": " << totals.statesNum << " states, "
+				<< totals.winFirstPlayerSum << ";" << totals.winSecondPlayerSum << ";" 
+				<< totals.equalResultsSum << "\n";
+		}
+		out1.close();
+
+
+		std::cout << "Log file has been written" << std::endl;
+	}
+	else {
+		StateTraversal traversal(*state_);
+		infoStateTree = InitialStateTree(traversal, 0);
+	}
+}
+
+void StateOutcomesTree::CloseSubsetFiles(
+	std::vector<std::unique_ptr<IndexedStateTreeWriter>>& subsets, 
+	SubsetCheckpoint& checkpoint, std::string statisticFile, std::string logFile,
+	std::string gameLength, std::string boardSize) {
+
+	// Дозапись и закрытие файлов подмножеств.
+	// В текстовый файл statisticFile для каждого 
+	// подмножества записывается информация о нём.
+	
+	// Название файла с подмножеством, 
+	// количество начальных состояний игры в подмножестве,
+	// gameLength, boardSize - информация об игре,
+	// winX, winO, equalRezults - количества разных 
+	// исходов для всех начальных состояний,
+	// allWins - общее количество исходов, 
+	// процентные шансы каждого исхода.
+	// Счётчики подмножеств добавляются к контрольной точке
+
+	for (size_t i = 0; i < subsets.size(); i++) {
+		auto& writer = subsets[i];
+		std::ofstream out;
+		out.open(logFile, std::ios::app);
+		out << "1. " << writer->FileName() << " outcomes serialize...\n";
+		auto start = std::chrono::high_resolution_clock::now();
+
+		writer->Close();
+
+		auto end = std::chrono::high_resolution_clock::now();
+		// Вычисляем продолжительность
+		std::chrono::duration<double> duration = end - start;
+		out << "Outcomes serialized. Time = " << duration.count() << " s.\n";
+		out.close();
+
+		const IndexedStateTreeHeader& header = writer->GetHeader();
+		OutcomeCounter winX = header.winFirstPlayerSum, 
+			winO = header.winSecondPlayerSum, 
+			equalRezults = header.equalResultsSum;
+		double allWins = winX + winO + equalRezults;
+
+		out.open(statisticFile, std::ios::app);
+		out << writer->FileName() << ";" << header.numStates << ";" 
+			<< gameLength << ";" << boardSize << ";" <<
+			winX << ";" << winO << ";" << equalRezults << ";" 
+			<< allWins << ";" << winX / allWins << ";" 
+			<< winO / allWins << ";" << equalRezults / allWins 
+			<< ";" << "\n";
+		out.close();
+
+		SubsetCheckpoint::Totals& totals = checkpoint.subsets[i];
+		totals.statesNum += header.numStates;
+		totals.winFirstPlayerSum += winX;
+		totals.winSecondPlayerSum += winO;
+		totals.equalResultsSum += equalRezults;
+		checkpoint.files.push_back(writer->FileName());
+	}
+	subsets.clear();
+}
+
+
+//////////////////////////////////////GameAnalysis/////////////////////////////////////////
+
+std::string ActionsToString(const std::vector<int>& actions) {
+	std::string history;
+	for (size_t i = 0; i < actions.size(); i++) {
+		if (i > 0) {
+			history += ", ";
+		}
+		history += std::to_string(actions[i]);
+	}
+	return history;
+}
+
+std::string GameAnalysis::GetStartedStateHistory() const {
+
+	// Получить историю состояний вычесленного состояния.
+	// В узлах дерева истории не хранятся, путь к искомому 
+	// узлу запоминается во время поиска
+
+	return ActionsToString(optimalHistory);
+}
+
+std::unique_ptr<OutcomeCounter[]> GameAnalysis::GetStartedStateOutcomesNum() {
+
+	// Получить количество исходов для вычесленного состояния
+
+	std::unique_ptr<OutcomeCounter[]> result{
+		new OutcomeCounter[3] {
+			optimalStartedState->winFirstPlayerSum,
+			optimalStartedState->winSecondPlayerSum,
+			optimalStartedState->equalResultsSum
+		}
+	};
+	return std::move(result);
+}
+
+//////////////////////////////////////TreeAnalysis/////////////////////////////////////////
+
+std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) {
+	
+}
+
+//////////////////////////////////////FirstPlayerAnalysis/////////////////////////////////////////
+
+double FirstPlayerAnalysis::StateDiff(OutcomeCounter winFirstPlayer, OutcomeCounter winSecondPlayer, OutcomeCounter equalResults) const {
+	double sumRez = winFirstPlayer + winSecondPlayer + equalResults;
+	return (winSecondPlayer - winFirstPlayer) / sumRez;
+}
+
+std::unique_ptr<StateTree> FirstPlayerAnalysis::FirstPlayerStartedStateSearch(std::unique_ptr<StateTree> infoState, int depth) {
+
+	// Обход дерева исходов до определенной глубины и поиск самого выгодного состояния для игрока
+
+	if (depth == depthLimit - 1) {
+
+
+		OutcomeCounter winFirstPlayer = infoState->winFirstPlayerSum;
+		OutcomeCounter winSecondPlayer = infoState->winSecondPlayerSum;
+		double sumRez = winFirstPlayer + winSecondPlayer + infoState->equalResultsSum;
+
+		double diff = (winSecondPlayer - winFirstPlayer) / sumRez;
+
+		if (diff < minDiff) {
+			minDiff = diff;
+
+			optimalStartedState->winFirstPlayerSum = infoState->winFirstPlayerSum;
+			optimalStartedState->winSecondPlayerSum = infoState->winSecondPlayerSum;
+			optimalStartedState->equalResultsSum = infoState->equalResultsSum;
+			optimalHistory = actionPath;
+		}
+	}
+
+	for (auto& stateElement : infoState->states) {
+		actionPath.push_back(stateElement.first);
+		stateElement.second = FirstPlayerStartedStateSearch(std::move(stateElement.second), depth + 1);
+		actionPath.pop_back();
+	}
+
+	return std::move(infoState);
+}
+
+std::unique_ptr<StateTree> FirstPlayerAnalysis::StartedStateSearch(std::unique_ptr<StateTree> infoState, int depthLimit_) {
+
+	// Внешняя функция к к обходу дерева исходов (переопределенная функция базового класса)
+
+	optimalStartedState = std::make_unique<StateTree>();
+	this->depthLimit = depthLimit_;
+	this->minDiff = 100;
+	actionPath.clear();
+	optimalHistory.clear();
+
+	return FirstPlayerStartedStateSearch(std::move(infoState), 0);
+}
+
+//////////////////////////////////////SecondPlayerAnalysis/////////////////////////////////////////
+
+double SecondPlayerAnalysis::StateDiff(OutcomeCounter winFirstPlayer, OutcomeCounter winSecondPlayer, OutcomeCounter equalResults) const {
+	double sumRez = winFirstPlayer + winSecondPlayer + equalResults;
+	return (winFirstPlayer - winSecondPlayer) / sumRez;
+}
+
+std::unique_ptr<StateTree> SecondPlayerAnalysis::SecondPlayerStartedStateSearch(std::unique_ptr<StateTree> infoState, int depth) {
+
+	// Обход дерева исходов до определенной глубины и поиск самого выгодного состояния для игрока
+
+	if (depth == depthLimit - 1) {
+
+
+		OutcomeCounter winFirstPlayer = infoState->winFirstPlayerSum;
+		OutcomeCounter winSecondPlayer = infoState->winSecondPlayerSum;
+		double sumRez = winFirstPlayer + winSecondPlayer + infoState->equalResultsSum;
+
+		double diff = (winFirstPlayer - winSecondPlayer) / sumRez;
+
+		if (diff < minDiff) {
+			minDiff = diff;
+
+			optimalStartedState->winFirstPlayerSum = infoState->winFirstPlayerSum;
+			optimalStartedState->winSecondPlayerSum = infoState->winSecondPlayerSum;
+			optimalStartedState->equalResultsSum = infoState->equalResultsSum;
+			optimalHistory = actionPath;
+		}
+	}
+
+	for (auto& stateElement : infoState->states) {
+		actionPath.push_back(stateElement.first);
+		stateElement.second = SecondPlayerStartedStateSearch(std::move(stateElement.second), depth + 1);
+		actionPath.pop_back();
+	}
+	return std::move(infoState);
+}
+
+std::unique_ptr<StateTree> SecondPlayerAnalysis::StartedStateSearch(std::unique_ptr<StateTree> infoState, int depthLimit_) {
+
+	// Внешняя функция к к обходу дерева исходов (переопределенная функция базового класса)
+
+	optimalStartedState = std::make_unique<StateTree>();
+	this->depthLimit = depthLimit_;
+	this->minDiff = 100;
+	actionPath.clear();
+	optimalHistory.clear();
+
+	return SecondPlayerStartedStateSearch(std::move(infoState), 0);
+}
+
+//////////////////////////////////////EqualResultAnalysis/////////////////////////////////////////
+
+double EqualResultAnalysis::StateDiff(OutcomeCounter winFirstPlayer, OutcomeCounter winSecondPlayer, OutcomeCounter equalResults) const {
+	double sumRez = winFirstPlayer + winSecondPlayer + equalResults;
+	return abs(winFirstPlayer - winSecondPlayer) / sumRez;
+}
+
+std::unique_ptr<StateTree> EqualResultAnalysis::EqualResultStartedStateSearch(std::unique_ptr<StateTree> infoState, int depth) {
+
+	// Обход дерева исходов до определенной глубины и поиск самого выгодного состояния для игрока
+
+	if (depth == depthLimit - 1) {
+
+
+		OutcomeCounter winFirstPlayer = infoState->winFirstPlayerSum;
+		OutcomeCounter winSecondPlayer = infoState->winSecondPlayerSum;
+		double sumRez = winFirstPlayer + winSecondPlayer + infoState->equalResultsSum;
+
+		double diff = abs(winFirstPlayer - winSecondPlayer) / sumRez;
+
+		if (diff < minDiff) {
+			minDiff = diff;
+
+			optimalStartedState->winFirstPlayerSum = infoState->winFirstPlayerSum;
+			optimalStartedState->winSecondPlayerSum = infoState->winSecondPlayerSum;
+			optimalStartedState->equalResultsSum = infoState->equalResultsSum;
+			optimalHistory = actionPath;
+		}
+	}
+
+	for (auto& stateElement : infoState->states) {
+		actionPath.push_back(stateElement.first);
+		stateElement.second = EqualResultStartedStateSearch(std::move(stateElement.second), depth + 1);
+		actionPath.pop_back();
+	}
+	return std::move(infoState);
+}
+
+std::unique_ptr<StateTree> EqualResultAnalysis::StartedStateSearch(std::unique_ptr<StateTree> infoState, int depthLimit_) {
+
+	// Внешняя функция к к обходу дерева исходов (переопределенная функция базового класса)
+
+	optimalStartedState = std::make_unique<StateTree>();
+	this->depthLimit = depthLimit_;
+	this->minDiff = 100;
+	actionPath.clear();
+	optimalHistory.clear();
+
+	return EqualResultStartedStateSearch(std::move(infoState), 0);
+}
+
+//////////////////////////////////////MultiObjectiveAnalysis/////////////////////////////////////////
+
+std::string StateCandidate::History() const {
+	return ActionsToString(actions);
+}
+
+// Порядок кандидатов: сначала меньший diff, затем более ранний узел
+static bool BetterCandidate(const StateCandidate& a, const StateCandidate& b) {
+	return a.diff < b.diff || (a.diff == b.diff && a.order < b.order);
+}
+
+MultiObjectiveAnalysis::MultiObjectiveAnalysis(size_t topK_) : topK(topK_ == 0 ? 1 : topK_) {
+	objectives[kFirstPlayer] = std::make_unique<FirstPlayerAnalysis>();
+	objectives[kSecondPlayer] = std::make_unique<SecondPlayerAnalysis>();
+	objectives[kEqualResult] = std::make_unique<EqualResultAnalysis>();
+}
+
+void MultiObjectiveAnalysis::Start(int depthLimit_) {
+	depthLimit = depthLimit_;
+	visited = 0;
+	path.clear();
+	for (auto& heap : candidates) {
+		heap.clear();
+	}
+}
+
+void MultiObjectiveAnalysis::Consider(Heaps& heaps, uint64_t order,
+	OutcomeCounter winFirstPlayer, OutcomeCounter winSecondPlayer, OutcomeCounter equalResults, 
+	const std::vector<int>& actions) const {
+
+	// Кучи упорядочены так, что сверху худший из topK кандидатов.
+	// Путь копируется только при попадании узла в кучу
+
+	for (int objective = 0; objective < kObjectivesNum; objective++) {
+		std::vector<StateCandidate>& heap = heaps[objective];
+		double diff = objectives[objective]->StateDiff(winFirstPlayer, winSecondPlayer, equalResults);
+		if (heap.size() == topK && !(diff < heap.front().diff)) {
+			continue;
+		}
+
+		StateCandidate candidate;
+		candidate.diff = diff;
+		candidate.order = order;
+		candidate.actions = actions;
+		candidate.winFirstPlayerSum = winFirstPlayer;
+		candidate.winSecondPlayerSum = winSecondPlayer;
+		candidate.equalResultsSum = equalResults;
+
+		if (heap.size() == topK) {
+			std::pop_heap(heap.begin(), heap.end(), BetterCandidate);
+			heap.back() = std::move(candidate);
+		}
+		else {
+			heap.push_back(std::move(candidate));
+		}
+		std::push_heap(heap.begin(), heap.end(), BetterCandidate);
+	}
+}
+
+void MultiObjectiveAnalysis::Finish() {
+	for (auto& heap : candidates) {
+		std::sort_heap(heap.begin(), heap.end(), BetterCandidate);
+	}
+}
+
+void MultiObjectiveAnalysis::FlatSearch(FlatStateTree::Node node, int depth) {
+	if (depth == depthLimit - 1) {
+		Consider(candidates, visited++, 
+			node.winFirstPlayerSum(), node.winSecondPlayerSum(), node.equalResultsSum(), path);
+		return;
+	}
+	for (const auto& child : node) {
+		path.push_back(child.key());
+		FlatSearch(child, depth + 1);
+		path.pop_back();
+	}
+}
+
+void MultiObjectiveAnalysis::TreeSearch(const StateTree& infoState, int depth) {
+	if (depth == depthLimit - 1) {
+		Consider(candidates, visited++, 
+			infoState.winFirstPlayerSum, infoState.winSecondPlayerSum, infoState.equalResultsSum, path);
+		return;
+	}
+	for (const auto& [key, child] : infoState.states) {
+		path.push_back(key);
+		TreeSearch(*child, depth + 1);
+		path.pop_back();
+	}
+}
+
+void MultiObjectiveAnalysis::StartedLevelSearch(const FlatStateTree& infoState, int depthLimit_) {
+
+	// Обход в глубину только до глубины depthLimit - 1: 
+	// в плоском дереве нет ссылок на родителей, 
+	// поэтому путь к узлу собирается во время спуска
+
+	Start(depthLimit_);
+	if (depthLimit > 0 && !infoState.Empty()) {
+		FlatSearch(infoState.Root(), 0);
+	}
+	Finish();
+}
+
+void MultiObjectiveAnalysis::StartedLevelSearch(const FlatStateTree& infoState, int depthLimit_, unsigned threadsNum) {
+
+	// Номер узла в порядке обхода в глубину совпадает 
+	// с его номером внутри глубины плоского дерева, поэтому 
+	// отрезки глубины просматриваются независимо, а пути 
+	// ищутся только для узлов, оставшихся в итоговых кучах
+
+	Start(depthLimit_);
+	int depth = depthLimit - 1;
+	if (depth < 0 || depth >= static_cast<int>(infoState.LevelsNum())) {
+		return;
+	}
+	if (threadsNum == 0) {
+		threadsNum = ThreadPool::DefaultThreadsNum();
+	}
+
+	// По несколько отрезков на поток, 
+	// чтобы перехват задач выравнивал нагрузку
+	uint32_t begin = infoState.LevelBegin(depth), end = infoState.LevelEnd(depth);
+	uint32_t chunksNum = std::max<uint32_t>(1, std::min<uint32_t>(end - begin, threadsNum * 8));
+	uint32_t chunkSize = std::max<uint32_t>(1, (end - begin + chunksNum - 1) / chunksNum);
+	chunksNum = (end - begin + chunkSize - 1) / chunkSize;
+
+	std::vector<Heaps> chunkHeaps(chunksNum);
+	const std::vector<int> noPath;
+	auto searchChunk = [this, &infoState, &chunkHeaps, &noPath, begin, end, chunkSize](uint32_t i) {
+		uint32_t first = begin + i * chunkSize;
+		uint32_t last = std::min(end, first + chunkSize);
+		for (uint32_t node = first; node < last; node++) {
+			FlatStateTree::Node current = infoState.At(node);
+			Consider(chunkHeaps[i], node - begin, current.winFirstPlayerSum(), 
+				current.winSecondPlayerSum(), current.equalResultsSum(), noPath);
+		}
+	};
+	if (threadsNum == 1) {
+		for (uint32_t i = 0; i < chunksNum; i++) {
+			searchChunk(i);
+		}
+	}
+	else {
+		ThreadPool pool(threadsNum);
+		for (uint32_t i = 0; i < chunksNum; i++) {
+			pool.Submit([&searchChunk, i]() { searchChunk(i); });
+		}
+		pool.Wait();
+	}
+
+	// Кучи отрезков сводятся в итоговые, порядок (diff, номер узла) 
+	// строгий, поэтому результат не зависит от разбиения на отрезки
+	for (int objective = 0; objective < kObjectivesNum; objective++) {
+		std::vector<StateCandidate>& heap = candidates[objective];
+		for (auto& chunk : chunkHeaps) {
+			for (auto& candidate : chunk[objective]) {
+				heap.push_back(std::move(candidate));
+			}
+		}
+		std::sort(heap.begin(), heap.end(), BetterCandidate);
+		if (heap.size() > topK) {
+			heap.resize(topK);
+		}
+		for (auto& candidate : heap) {
+			candidate.actions = infoState.PathTo(begin + static_cast<uint32_t>(candidate.order));
+		}
+	}
+	visited = end - begin;
+}
+
+void MultiObjectiveAnalysis::StartedStateSearch(const StateTree& infoState, int depthLimit_) {
+	Start(depthLimit_);
+	if (depthLimit > 0) {
+		TreeSearch(infoState, 0);
+	}
+	Finish();
+}
+
+
+//////////////////////////////////////ChanceNodeGameAnalysis/////////////////////////////////////////
+
+void ChanceNodeGameAnalysis::StrategyNum(StateTraversal& traversal, int depth) {
+
+	// Подсчет исходов обходом одного состояния через ApplyAction/UndoAction
+
+	open_spiel::State& state_ = traversal.GetState();
+	if (state_.IsTerminal()) {
+		auto result = traversal.FirstPlayerResult();
+		if (result > 0) {
+			winFirstPlayer += 1;
+		}
+		else if (result < 0) {
+			winSecondPlayer += 1;
+		}
+		else {
+			equalRezult += 1;
+		}
+		return;
+	}
+	open_spiel::Player player = state_.CurrentPlayer();
+	int actionsNum;
+	const open_spiel::Action* actions = traversal.LegalActions(depth, actionsNum);
+	for (int i = 0; i < actionsNum; i++) {
+		state_.ApplyAction(actions[i]);
+		StrategyNum(traversal, depth + 1);
+		state_.UndoAction(player, actions[i]);
+	}
+}
+
+struct ChanceNodeGameAnalysis::SplitItems {
+	open_spiel::Player mover;
+	int itemsNum;
+	// Ценности предметов для игрока, который ходит, и для соперника 
+	// по убыванию их суммы: предмет, который сильнее всего меняет 
+	// разность, распределяется раньше, и исход решается раньше
+	int moverBonus[64], otherBonus[64];
+	// Наибольшая и наименьшая сумма m ценностей 
+	// среди предметов i..itemsNum-1 ([i][m])
+	int moverMost[65][33], moverLeast[65][33];
+	int otherMost[65][33], otherLeast[65][33];
+	// Количество разделений n предметов, m из которых 
+	// у игрока, который ходит (C(n, m), [n][m])
+	OutcomeCounter splitsNum[65][33];
+	// Количество порядков ходов, приводящих к одному разделению
+	OutcomeCounter ordersNum;
+};
+
+bool ChanceNodeGameAnalysis::PartitionStrategyNum(StateTraversal& traversal) {
+
+	// Подсчет исходов без перебора порядков ходов.
+	// В Грибной поляне итог игры зависит только от того, 
+	// как k оставшихся предметов разделились между игроками: 
+	// игрок, который ходит, получает ceil(k/2) предметов, 
+	// соперник - floor(k/2). Каждое разделение получается 
+	// ровно ceil(k/2)! * floor(k/2)! порядками ходов, 
+	// поэтому перебираются не более C(k, ceil(k/2)) разделений 
+	// вместо k! конечных состояний, а разделения с уже 
+	// решённым исходом засчитываются целиком (SplitStrategyNum).
+	// Возвращает false, если состояние не подходит 
+	// для такого подсчета (тогда нужен обычный обход)
+
+	const MushroomGladeInterface* gladeState = traversal.GetGladeState();
+	if (!gladeState) {
+		return false;
+	}
+
+	int actionsNum;
+	const open_spiel::Action* actions = traversal.LegalActions(0, actionsNum);
+	if (actionsNum == 0 || actionsNum > 62 || actionsNum != gladeState->MovesLeft()) {
+		return false;
+	}
+
+	open_spiel::Player mover = traversal.GetState().CurrentPlayer();
+	open_spiel::Player other = 1 - mover;
+	int moverItemsNum = (actionsNum + 1) / 2, otherItemsNum = actionsNum / 2;
+
+	auto items = std::make_unique<SplitItems>();
+	items->mover = mover;
+	items->itemsNum = actionsNum;
+
+	items->ordersNum = 1;
+	for (int i = 2; i <= moverItemsNum; i++) items->ordersNum *= i;
+	for (int i = 2; i <= otherItemsNum; i++) items->ordersNum *= i;
+
+	std::vector<std::pair<int, int>> bonuses(actionsNum);
+	for (int i = 0; i < actionsNum; i++) {
+		bonuses[i].first = gladeState->ItemBonus(mover, actions[i]);
+		bonuses[i].second = gladeState->ItemBonus(other, actions[i]);
+	}
+	std::sort(bonuses.begin(), bonuses.end(), [](const auto& left, const auto& right) {
+		return left.first + left.second > right.first + right.second;
+	});
+	for (int i = 0; i < actionsNum; i++) {
+		items->moverBonus[i] = bonuses[i].first;
+		items->otherBonus[i] = bonuses[i].second;
+	}
+
+	// Границы сумм по отсортированным ценностям каждого остатка предметов
+	std::vector<int> rest;
+	for (int i = 0; i <= actionsNum; i++) {
+		for (int player = 0; player < 2; player++) {
+			const int* bonus = player == 0 ? items->moverBonus : items->otherBonus;
+			auto& most = player == 0 ? items->moverMost : items->otherMost;
+			auto& least = player == 0 ? items->moverLeast : items->otherLeast;
+			rest.assign(bonus + i, bonus + actionsNum);
+			std::sort(rest.begin(), rest.end(), std::greater<>());
+			int restNum = static_cast<int>(rest.size());
+			most[i][0] = least[i][0] = 0;
+			for (int m = 1; m <= std::min(restNum, moverItemsNum); m++) {
+				most[i][m] = most[i][m - 1] + rest[m - 1];
+				least[i][m] = least[i][m - 1] + rest[restNum - m];
+			}
+		}
+	}
+
+	for (int n = 0; n <= actionsNum; n++) {
+		for (int m = 0; m <= moverItemsNum; m++) {
+			items->splitsNum[n][m] = m == 0 ? 1 : n == 0 ? 0 :
+				items->splitsNum[n - 1][m - 1] + items->splitsNum[n - 1][m];
+		}
+	}
+
+	SplitStrategyNum(*items, 0, moverItemsNum, gladeState->EarnedBonus(mover) - gladeState->EarnedBonus(other));
+	return true;
+}
+
+void ChanceNodeGameAnalysis::SplitStrategyNum(const SplitItems& items, int item, int moverItemsNum, int difference) {
+
+	// Предметы распределяются по одному. difference - разность 
+	// сумм игрока, который ходит, и соперника с учётом уже 
+	// распределённых предметов. Если даже самые выгодные 
+	// для отстающего остатки предметов не меняют знак разности, 
+	// все C(n, m) разделений остатка дают один исход
+
+	int restNum = items.itemsNum - item;
+	int otherItemsNum = restNum - moverItemsNum;
+	int highest = difference + items.moverMost[item][moverItemsNum] - items.otherLeast[item][otherItemsNum];
+	int lowest = difference + items.moverLeast[item][moverItemsNum] - items.otherMost[item][otherItemsNum];
+	if (lowest > 0 || highest < 0 || (lowest == 0 && highest == 0)) {
+		int result = lowest > 0 ? 1 : highest < 0 ? -1 : 0;
+		if (items.mover != 0) {
+			result = -result;
+		}
+		OutcomeCounter outcomesNum = items.splitsNum[restNum][moverItemsNum] * items.ordersNum;
+		if (result > 0) {
+			winFirstPlayer += outcomesNum;
+		}
+		else if (result < 0) {
+			winSecondPlayer += outcomesNum;
+		}
+		else {
+			equalRezult += outcomesNum;
+		}
+		return;
+	}
+
+	if (moverItemsNum > 0) {
+		SplitStrategyNum(items, item + 1, moverItemsNum - 1, difference + items.moverBonus[item]);
+	}
+	if (otherItemsNum > 0) {
+		SplitStrategyNum(items, item + 1, moverItemsNum, difference - items.otherBonus[item]);
+	}
+}
+
+void ChanceNodeGameAnalysis::RangeStrategyNum(open_spiel::State& state_, 
+	const std::vector<std::pair<open_spiel::Action, double>>& outcomes, size_t begin, size_t end) {
+	StateTraversal traversal(state_);
+	for (size_t i = begin; i < end; i++) {
+		state_.ApplyAction(outcomes[i].first);
+		if (!PartitionStrategyNum(traversal)) {
+			StrategyNum(traversal, 0);
+		}
+		state_.UndoAction(open_spiel::kChancePlayerId, outcomes[i].first);
+	}
+}
+
+std::vector<OutcomeCounter> ChanceNodeGameAnalysis::GetStrategyNum(std::unique_ptr<open_spiel::State> state_) {
+	winFirstPlayer = 0;
+	winSecondPlayer = 0;
+	equalRezult = 0;
+	chanceNodeNum = 0;
+
+	if (state_->IsChanceNode()) {
+		std::vector<std::pair<open_spiel::Action, double>> outcomes =
+			state_->ChanceOutcomes();
+		chanceNodeNum = outcomes.size();
+		RangeStrategyNum(*state_, outcomes, 0, outcomes.size());
+	}
+
+	std::vector<OutcomeCounter> results{winFirstPlayer, winSecondPlayer, equalRezult, chanceNodeNum};
+	return results;
+}
+
+std::vector<std::vector<OutcomeCounter>> ChanceNodeGameAnalysis::GetSplitStrategyNum(
+	std::unique_ptr<open_spiel::State> state_, int split_, unsigned threadsNum) {
+
+	// Начальные состояния делятся на части по splitNum подряд, 
+	// остаток - последняя строка с общим количеством состояний. 
+	// Каждая часть считается своим объектом-счетчиком 
+	// на своей копии состояния и пишется в свою строку results
+
+	winFirstPlayer = 0;
+	winSecondPlayer = 0;
+	equalRezult = 0;
+	chanceNodeNum = 0;
+
+	std::vector<std::vector<OutcomeCounter>> results;
+
+	if (!state_->IsChanceNode()) {
+		results.push_back(std::vector<OutcomeCounter>{ 0, 0, 0, 0 });
+		return results;
+	}
+
+	std::vector<std::pair<open_spiel::Action, double>> outcomes =
+		state_->ChanceOutcomes();
+	chanceNodeNum = outcomes.size();
+
+	size_t splitNum = std::max<size_t>(1, chanceNodeNum / std::max(split_, 1));
+	size_t fullSplitsNum = outcomes.size() / splitNum;
+	results.resize(fullSplitsNum + 1);
+
+	const open_spiel::State& chanceState = *state_;
+	auto countSplit = [this, &chanceState, &outcomes, &results, splitNum, fullSplitsNum](size_t i) {
+		size_t begin = i * splitNum;
+		size_t end = std::min(outcomes.size(), begin + splitNum);
+
+		ChanceNodeGameAnalysis worker;
+		worker.winFirstPlayer = 0;
+		worker.winSecondPlayer = 0;
+		worker.equalRezult = 0;
+		worker.chanceNodeNum = chanceNodeNum;
+		std::unique_ptr<open_spiel::State> state = chanceState.Clone();
+		worker.RangeStrategyNum(*state, outcomes, begin, end);
+
+		OutcomeCounter statesNum = i < fullSplitsNum ? end : chanceNodeNum;
+		results[i] = std::vector<OutcomeCounter>{ 
+			worker.winFirstPlayer, worker.winSecondPlayer, worker.equalRezult, statesNum };
+	};
+
+	if (threadsNum == 1) {
+		for (size_t i = 0; i < results.size(); i++) {
+			countSplit(i);
+		}
+	}
+	else {
+		ThreadPool pool(threadsNum);
+		for (size_t i = 0; i < results.size(); i++) {
+			pool.Submit([&countSplit, i]() { countSplit(i); });
+		}
+		pool.Wait();
+	}
+
+	// Как и при последовательном подсчете, 
+	// в счетчиках остаются исходы последней строки
+	winFirstPlayer = results.back()[0];
+	winSecondPlayer = results.back()[1];
+	equalRezult = results.back()[2];
+	return results;
+}
+
+//////////////////////////////////////MonteCarloGameAnalysis/////////////////////////////////////////
+
+MonteCarloGameAnalysis::MonteCarloGameAnalysis(double precision_, double z_, uint64_t maxPlayouts_, uint64_t seed_)
+	: precision(precision_), z(z_), maxPlayouts(maxPlayouts_), seed(seed_) {
+	if (!(precision > 0) || !(z > 0)) {
+		throw std::invalid_argument("MonteCarloGameAnalysis: precision and z must be positive");
+	}
+}
+
+std::vector<OutcomeCounter> MonteCarloGameAnalysis::GetStrategyEstimate(
+	std::unique_ptr<open_spiel::State> state_, unsigned threadsNum) {
+
+	// Партии играются раундами: в каждом раунде каждый генератор 
+	// играет одинаковое количество партий, затем проверяется точность. 
+	// Генераторы привязаны к номеру, а не к потоку пула, 
+	// поэтому порядок выполнения задач не влияет на результат
+
+	if (threadsNum == 0) {
+		threadsNum = ThreadPool::DefaultThreadsNum();
+	}
+	results[0] = results[1] = results[2] = 0;
+	playoutsNum = 0;
+	boardsNum = 0;
+	boards.clear();
+	boardChances.clear();
+
+	// Доски Грибной поляны не перечисляются: при 
+	// C(n, k) в сотни миллионов список исходов 
+	// не помещается в память
+
+	OutcomeCounter chanceNodeNum = 0;
+	auto gladeState = dynamic_cast<const MushroomGladeInterface*>(state_.get());
+	if (state_->IsChanceNode() && gladeState) {
+		boardsNum = gladeState->BoardsNum();
+		chanceNodeNum = boardsNum;
+	}
+	else if (state_->IsChanceNode()) {
+		double chance = 0;
+		for (const auto& [action, probability] : state_->ChanceOutcomes()) {
+			boards.push_back(action);
+			chance += probability;
+			boardChances.push_back(chance);
+		}
+		chanceNodeNum = boards.size();
+	}
+
+	std::vector<Stream> streams(threadsNum);
+	for (unsigned i = 0; i < threadsNum; i++) {
+		streams[i].state = state_->Clone();
+		streams[i].traversal = std::make_unique<StateTraversal>(*streams[i].state);
+		std::seed_seq sequence{ seed, static_cast<uint64_t>(i) };
+		streams[i].rng.seed(sequence);
+	}
+
+	std::unique_ptr<ThreadPool> pool;
+	if (threadsNum > 1) {
+		pool = std::make_unique<ThreadPool>(threadsNum);
+	}
+	while (playoutsNum < maxPlayouts && !(playoutsNum > 0 && PrecisionReached())) {
+		// В последнем раунде остаток делится между генераторами: 
+		// первые remaining % threadsNum играют на одну партию больше, 
+		// так что общее число партий не превышает maxPlayouts
+		uint64_t remaining = maxPlayouts - playoutsNum;
+		uint64_t batch = std::min(kBatchPlayouts, remaining / threadsNum);
+		uint64_t extra = batch < kBatchPlayouts ? remaining % threadsNum : 0;
+		if (pool) {
+			for (unsigned i = 0; i < threadsNum; i++) {
+				uint64_t playouts = batch + (i < extra ? 1 : 0);
+				if (playouts > 0) {
+					pool->Submit([this, &stream = streams[i], playouts]() { Playouts(stream, playouts); });
+				}
+			}
+			pool->Wait();
+		}
+		else {
+			Playouts(streams[0], batch + extra);
+		}
+
+		results[0] = results[1] = results[2] = 0;
+		for (const auto& stream : streams) {
+			for (int i = 0; i < 3; i++) {
+				results[i] += stream.results[i];
+			}
+		}
+		playoutsNum = results[0] + results[1] + results[2];
+	}
+
+	return std::vector<OutcomeCounter>{ results[0], results[1], results[2], chanceNodeNum };
+}
+
+void MonteCarloGameAnalysis::Playouts(Stream& stream, uint64_t playouts) const {
+
+	// Партия идёт на одном состоянии через ApplyAction, 
+	// после конца партии ходы отменяются в обратном порядке
+
+	open_spiel::State& state = *stream.state;
+	std::uniform_real_distribution<double> chanceDistribution(0.0, boardChances.empty() ? 1.0 : boardChances.back());
+	for (uint64_t playout = 0; playout < playouts; playout++) {
+		stream.history.clear();
+		int depth = 0;
+		while (!state.IsTerminal()) {
+			open_spiel::Player player = state.CurrentPlayer();
+			open_spiel::Action action;
+			if (state.IsChanceNode() && depth == 0 && boardsNum > 0) {
+				action = std::uniform_int_distribution<uint64_t>(0, boardsNum - 1)(stream.rng);
+			}
+			else if (state.IsChanceNode() && depth == 0) {
+				size_t board = std::upper_bound(boardChances.begin(), boardChances.end(), 
+					chanceDistribution(stream.rng)) - boardChances.begin();
+				action = boards[std::min(board, boards.size() - 1)];
+			}
+			else if (state.IsChanceNode()) {
+				// Случайные узлы не в корне встречаются редко, 
+				// их исходы не запоминаются
+				auto outcomes = state.ChanceOutcomes();
+				double point = std::uniform_real_distribution<double>(0.0, 1.0)(stream.rng), chance = 0;
+				action = outcomes.back().first;
+				for (const auto& [outcome, probability] : outcomes) {
+					chance += probability;
+					if (point < chance) {
+						action = outcome;
+						break;
+					}
+				}
+			}
+			else {
+				int actionsNum;
+				const open_spiel::Action* actions = stream.traversal->LegalActions(depth, actionsNum);
+				std::uniform_int_distribution<int> moveDistribution(0, actionsNum - 1);
+				action = actions[moveDistribution(stream.rng)];
+			}
+			state.ApplyAction(action);
+			stream.history.emplace_back(player, action);
+			depth++;
+		}
+
+		int result = stream.traversal->FirstPlayerResult();
+		stream.results[result > 0 ? 0 : result < 0 ? 1 : 2]++;
+
+		for (auto it = stream.history.rbegin(); it != stream.history.rend(); ++it) {
+			state.UndoAction(it->first, it->second);
+		}
+	}
+}
+
+double MonteCarloGameAnalysis::Rate(int outcome) const {
+	return playoutsNum == 0 ? 0 : static_cast<double>(results[outcome]) / playoutsNum;
+}
+
+double MonteCarloGameAnalysis::HalfWidth(int outcome) const {
+	double n = static_cast<double>(playoutsNum), p = Rate(outcome);
+	return z / (1 + z * z / n) * std::sqrt(p * (1 - p) / n + z * z / (4 * n * n));
+}
+
+double MonteCarloGameAnalysis::Lower(int outcome) const {
+	if (playoutsNum == 0) return 0;
+	double n = static_cast<double>(playoutsNum);
+	double center = (Rate(outcome) + z * z / (2 * n)) / (1 + z * z / n);
+	return std::max(0.0, center - HalfWidth(outcome));
+}
+
+double MonteCarloGameAnalysis::Upper(int outcome) const {
+	if (playoutsNum == 0) return 1;
+	double n = static_cast<double>(playoutsNum);
+	double center = (Rate(outcome) + z * z / (2 * n)) / (1 + z * z / n);
+	return std::min(1.0, center + HalfWidth(outcome));
+}
+
+bool MonteCarloGameAnalysis::PrecisionReached() const {
+	for (int outcome = 0; outcome < 3; outcome++) {
+		if (playoutsNum == 0 || HalfWidth(outcome) > precision) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//////////////////////////////////////MinimaxSolver/////////////////////////////////////////
+
+int MinimaxSolver::Solve(open_spiel::State& state) {
+
+	// Таблица действительна только для одной доски, 
+	// поэтому очищается перед каждым решением. 
+	// В Грибной поляне ходить можно только в ячейки 
+	// с предметами, поэтому все будущие ходы - 
+	// среди доступных в корне
+
+	if (state.IsChanceNode()) {
+		throw std::invalid_argument("MinimaxSolver: state must not be a chance node");
+	}
+
+	StateTraversal traversal(state);
+	table.clear();
+	cells[0] = cells[1] = 0;
+	nodesNum = 0;
+	rootBestMove = open_spiel::kInvalidAction;
+
+	useTable = traversal.GetGladeState() != nullptr;
+	if (useTable && !state.IsTerminal()) {
+		int actionsNum;
+		const open_spiel::Action* actions = traversal.LegalActions(0, actionsNum);
+		for (int i = 0; i < actionsNum; i++) {
+			useTable &= actions[i] >= 0 && actions[i] < 64;
+		}
+	}
+
+	return AlphaBeta(traversal, 0, -1, 1);
+}
+
+open_spiel::Action MinimaxSolver::BestMove(open_spiel::State& state) {
+	Solve(state);
+	return rootBestMove;
+}
+
+const open_spiel::Action* MinimaxSolver::OrderMoves(
+	StateTraversal& traversal, int depth, open_spiel::Action tableMove, int& actionsNum) {
+
+	const open_spiel::Action* actions = traversal.LegalActions(depth, actionsNum);
+	if (static_cast<size_t>(depth) >= moveBuffers.size()) {
+		moveBuffers.resize(depth + 1);
+	}
+	std::vector<open_spiel::Action>& moves = moveBuffers[depth];
+	moves.assign(actions, actions + actionsNum);
+
+	const MushroomGladeInterface* gladeState = traversal.GetGladeState();
+	if (gladeState) {
+		open_spiel::Player player = traversal.GetState().CurrentPlayer();
+		std::stable_sort(moves.begin(), moves.end(), 
+			[gladeState, player](open_spiel::Action a, open_spiel::Action b) {
+				return gladeState->ItemBonus(player, a) > gladeState->ItemBonus(player, b);
+			});
+	}
+	auto it = std::find(moves.begin(), moves.end(), tableMove);
+	if (it != moves.end()) {
+		std::rotate(moves.begin(), it, it + 1);
+	}
+	return moves.data();
+}
+
+int MinimaxSolver::AlphaBeta(StateTraversal& traversal, int depth, int alpha, int beta) {
+
+	// Первый игрок максимизирует результат, второй минимизирует.
+	// Значения только -1, 0, 1, поэтому окно быстро сужается 
+	// и отсечения происходят уже при первой найденной победе
+
+	open_spiel::State& state = traversal.GetState();
+	if (state.IsTerminal()) {
+		return traversal.FirstPlayerResult();
+	}
+	nodesNum++;
+
+	open_spiel::Player player = state.CurrentPlayer();
+	PositionKey key{ cells[0], cells[1], player };
+	open_spiel::Action tableMove = open_spiel::kInvalidAction;
+	if (useTable) {
+		auto it = table.find(key);
+		if (it != table.end()) {
+			const Entry& entry = it->second;
+			tableMove = entry.bestMove;
+			if (entry.bound == Bound::kExact) {
+				if (depth == 0) rootBestMove = entry.bestMove;
+				return entry.value;
+			}
+			if (entry.bound == Bound::kLower) alpha = std::max<int>(alpha, entry.value);
+			else beta = std::min<int>(beta, entry.value);
+			if (alpha >= beta) {
+				if (depth == 0) rootBestMove = entry.bestMove;
+				return entry.value;
+			}
+		}
+	}
+
+	int alphaStart = alpha, betaStart = beta;
+	int actionsNum;
+	const open_spiel::Action* moves = OrderMoves(traversal, depth, tableMove, actionsNum);
+
+	int best = player == 0 ? -2 : 2;
+	open_spiel::Action bestMove = open_spiel::kInvalidAction;
+	for (int i = 0; i < actionsNum && alpha < beta; i++) {
+		open_spiel::Action move = moves[i];
+		uint64_t bit = useTable ? uint64_t{ 1 } << move : 0;
+
+		state.ApplyAction(move);
+		cells[player] |= bit;
+		int value = AlphaBeta(traversal, depth + 1, alpha, beta);
+		cells[player] &= ~bit;
+		state.UndoAction(player, move);
+
+		if (player == 0 ? value > best : value < best) {
+			best = value;
+			bestMove = move;
+		}
+		if (player == 0) alpha = std::max(alpha, best);
+		else beta = std::min(beta, best);
+	}
+
+	if (useTable) {
+		Bound bound = best <= alphaStart ? Bound::kUpper
+			: best >= betaStart ? Bound::kLower : Bound::kExact;
+		table[key] = Entry{ static_cast<int8_t>(best), bound, bestMove };
+	}
+	if (depth == 0) {
+		rootBestMove = bestMove;
+	}
+	return best;
+}
+
+std::vector<BoardValue> MinimaxSolver::SolveBoards(const open_spiel::State& state, unsigned threadsNum) {
+
+	// Каждая доска решается отдельной задачей 
+	// со своей таблицей транспозиций
+
+	std::vector<BoardValue> values;
+	auto solveBoard = [](open_spiel::State& boardState, BoardValue& value) {
+		MinimaxSolver solver;
+		value.value = solver.Solve(boardState);
+		value.bestMove = solver.rootBestMove;
+		value.nodesNum = solver.NodesNum();
+	};
+
+	if (!state.IsChanceNode()) {
+		values.resize(1);
+		std::unique_ptr<open_spiel::State> root = state.Clone();
+		solveBoard(*root, values[0]);
+		return values;
+	}
+
+	std::vector<std::pair<open_spiel::Action, double>> outcomes = state.ChanceOutcomes();
+	values.resize(outcomes.size());
+	auto solveOutcome = [&state, &outcomes, &values, &solveBoard](size_t i) {
+		values[i].board = outcomes[i].first;
+		std::unique_ptr<open_spiel::State> board = state.Child(outcomes[i].first);
+		solveBoard(*board, values[i]);
+	};
+	if (threadsNum == 1) {
+		for (size_t i = 0; i < outcomes.size(); i++) {
+			solveOutcome(i);
+		}
+	}
+	else {
+		ThreadPool pool(threadsNum);
+		for (size_t i = 0; i < outcomes.size(); i++) {
+			pool.Submit([&solveOutcome, i]() { solveOutcome(i); });
+		}
+		pool.Wait();
+	}
+	return values;
 }
\ No newline at end of file
@@ -1,175 +1,1094 @@
-#pragma once
-#include <windows.h>  //    CreateFile, CreateFileMapping, MapViewOfFile, UnmapViewOfFile
-#include <map>        //  std::map
-#include <memory>     //  std::unique_ptr
-#include <string>     //  std::string
-#include <stdexcept>  //  std::runtime_error
-#include <cstring>    //  memcpy
-#include <iostream>   //    ()
-
-#include <chrono>
-
-#include <math.h>
-#include <vector>
-#include <fstream>
-
-#include <iterator>
-#include <sstream>
-
-#include "open_spiel/spiel.h"
-#include "open_spiel/spiel_utils.h"
-//
-
-
-/////////////////////StateOutcomesTree///////////////////////
-//      
-
-struct StateTree {
-	//        
-	int winFirstPlayerSum{ 0 };  
-	//       
-	int winSecondPlayerSum{ 0 };
-	//  -  
-	int equalResultsSum{ 0 };  
-
-	//    
-	std::map<int, std::unique_ptr<StateTree>> states;  
-
-
-	void saveToBinary(std::ofstream& out) const {
-		//   
-		out.write(reinterpret_cast<const char*>(&winFirstPlayerSum), sizeof(winFirstPlayerSum));
-		out.write(reinterpret_cast<const char*>(&winSecondPlayerSum), sizeof(winSecondPlayerSum));
-		out.write(reinterpret_cast<const char*>(&equalResultsSum), sizeof(equalResultsSum));
-
-		//   
-		size_t numStates = states.size();
-		out.write(reinterpret_cast<const char*>(&numStates), sizeof(numStates));
-
-		//    
-		std::vector<int> keys;
-		keys.reserve(numStates);
-		for (const auto& [key, child] : states) {
-			keys.push_back(key);
-		}
-		out.write(reinterpret_cast<const char*>(keys.data()), keys.size() * sizeof(int));
-
-		for (const auto& [key, child] : states) {
-			child->saveToBinary(out);
-		}
-	}
-
-	void loadFromBinary(std::ifstream& in) {
-		//   
-		in.read(reinterpret_cast<char*>(&winFirstPlayerSum), sizeof(winFirstPlayerSum));
-		in.read(reinterpret_cast<char*>(&winSecondPlayerSum), sizeof(winSecondPlayerSum));
-		in.read(reinterpret_cast<char*>(&equalResultsSum), sizeof(equalResultsSum));
-
-		//   
-		size_t numStates;
-		in.read(reinterpret_cast<char*>(&numStates), sizeof(numStates));
-
-		//  
-		std::vector<int> keys(numStates);
-		in.read(reinterpret_cast<char*>(keys.data()), keys.size() * sizeof(int));
-
-		//  
-		for (size_t i = 0; i < numStates; ++i) {
-			auto child = std::make_unique<StateTree>();
-			child->loadFromBinary(in);
-			states[keys[i]] = std::move(child);
-		}
-	}
-};
-
-
-
-class StateOutcomesTree {
-private:
-	std::unique_ptr<StateTree> infoStateTree;  //     
-	std::unique_ptr<StateTree> InitialStateTree(std::unique_ptr<open_spiel::State>);
-	void SerializeStateTree(
-		std::unique_ptr<StateTree>,
-		std::string,
-		std::string, std::string,
-		std::string, std::string);
-public:
-	void FindAndSerializeStateTree(
-		std::unique_ptr<open_spiel::State>,
-		std::string, std::string,
-		std::string, std::string,
-		std::string, int);
-	StateOutcomesTree() { infoStateTree = std::make_unique<StateTree>(); }
-	void FindStateTree(std::unique_ptr<open_spiel::State>);
-	std::unique_ptr<StateTree> GetTree();
-	void SetTree(std::unique_ptr<StateTree>);
-	void Serialize(std::string);
-	void Deserialize(std::string);
-
-};
-
-
-/////////////////////GameAnalysis///////////////////////
-//     
-
-class GameAnalysis {
-public:
-	virtual std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) = 0;
-	std::string GetStartedStateHistory() const;
-	std::unique_ptr<int[]> GetStartedStateOutcomesNum();
-
-protected:
-	int depthLimit;  //     
-	double minDiff;  //     , 
-	//      
-	std::unique_ptr<StateTree> optimalStartedState; //    
-};
-
-class TreeAnalysis : public GameAnalysis {
-public:
-	std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) override;
-};
-
-//      
-class FirstPlayerAnalysis : public GameAnalysis {
-public:
-	std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) override;
-
-private:
-	std::unique_ptr<StateTree> FirstPlayerStartedStateSearch(std::unique_ptr<StateTree>, int);
-};
-
-//      
-class SecondPlayerAnalysis : public GameAnalysis {
-public:
-	std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) override;
-
-private:
-	std::unique_ptr<StateTree> SecondPlayerStartedStateSearch(std::unique_ptr<StateTree>, int);
-};
-
-//    
-class EqualResultAnalysis : public GameAnalysis {
-public:
-	std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) override;
-
-private:
-	std::unique_ptr<StateTree> EqualResultStartedStateSearch(std::unique_ptr<StateTree>, int);
-};
-
-
-/////////////////////ChanceNodeGameAnalysis///////////////////////
-
-class ChanceNodeGameAnalysis {
-private:
-	int winFirstPlayer;
-	int winSecondPlayer;
-	int equalRezult;
-	int chanceNodeNum;
-
-	void StrategyNum(std::unique_ptr<open_spiel::State>);
-
-public:
-	std::vector<int> GetStrategyNum(std::unique_ptr<open_spiel::State>);
-	std::vector<std::vector<int>> GetSplitStrategyNum(std::unique_ptr<open_spiel::State>, int);
+#pragma once
+#include <windows.h>  // Для работы с CreateFile, CreateFileMapping, MapViewOfFile, UnmapViewOfFile
+#include <map>        // Для std::map
+#include <memory>     // Для std::unique_ptr
+#include <string>     // Для std::string
+#include <stdexcept>  // Для std::runtime_error
+#include <cstring>    // Для memcpy
+#include <cstdio>     // Для std::rename, std::remove
+#include <iostream>   // Для тестового вывода (опционально)
+
+#include <chrono>
+
+#include <math.h>
+#include <vector>
+#include <fstream>
+
+#include <iterator>
+#include <sstream>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+#include <set>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <array>
+#include <random>
+
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+#include "../ThreadPool/ThreadPool.h"
+#include "../MushroomGladeInterface/MushroomGladeInterface.h"
+
+
+/////////////////////Счётчики исходов///////////////////////
+// TreeCounter - счётчики исходов в узлах деревьев и в файлах деревьев.
+// По умолчанию 32 бита, чтобы деревья занимали меньше места, 
+// для больших вариантов игр проект собирается с 
+// GAME_BALANCE_WIDE_TREE_COUNTERS. Ширина счётчика записывается 
+// в заголовки файлов, файлы с другой шириной не читаются.
+// OutcomeCounter - суммы исходов по многим деревьям, всегда 64 бита
+
+#ifdef GAME_BALANCE_WIDE_TREE_COUNTERS
+using TreeCounter = int64_t;
+#else
+using TreeCounter = int32_t;
+#endif
+using OutcomeCounter = int64_t;
+
+// Сумма исходов как счётчик узла, с проверкой переполнения
+inline TreeCounter ToTreeCounter(OutcomeCounter value) {
+	if (value > std::numeric_limits<TreeCounter>::max()) {
+		throw std::overflow_error("Outcome counter overflow, build with GAME_BALANCE_WIDE_TREE_COUNTERS");
+	}
+	return static_cast<TreeCounter>(value);
+}
+//
+
+
+/////////////////////StateTraversal///////////////////////
+// Обход дерева игры на одном изменяемом состоянии: 
+// переход в дочернее состояние - ApplyAction, 
+// возврат обратно - UndoAction, без копирования (Child).
+// Буферы доступных действий выделяются один раз 
+// для каждой глубины, поэтому для состояний 
+// MushroomGladeInterface обход не выделяет память в узлах
+
+class StateTraversal {
+public:
+	explicit StateTraversal(open_spiel::State&);
+
+	open_spiel::State& GetState() { return state; }
+
+	// Доступные действия на глубине depth.
+	// Буфер глубины не меняется при обходе более глубоких узлов
+	const open_spiel::Action* LegalActions(int depth, int& actionsNum);
+
+	// Результат конечного состояния для первого игрока (знак Returns()[0])
+	int FirstPlayerResult() const;
+
+	// Состояние Грибной поляны или nullptr для остальных игр
+	const MushroomGladeInterface* GetGladeState() const { return gladeState; }
+
+	// Наибольшее количество оставшихся ходов решённой позиции. 
+	// GameBot ходит по дочерним узлам дерева исходов, поэтому 
+	// поддерево решённой позиции строится целиком - около e * k! 
+	// узлов, при 8 ходах это примерно 110 тысяч. Более длинные 
+	// позиции не считаются решёнными и обходятся как обычно
+	static constexpr int kMaxDecidedMovesNum = 8;
+
+	// Упорядочить предметы корня обхода по ценности для каждого игрока. 
+	// Вызывается в корне (начальное состояние после случайного узла) 
+	// с его доступными действиями, ниже корня границы 
+	// оставшихся ценностей считаются по этим порядкам
+	void PrepareBonusBounds(const open_spiel::Action*, int);
+
+	// Исход Грибной поляны уже решён: даже если отстающий игрок 
+	// возьмёт самые ценные для себя оставшиеся предметы, а лидер - 
+	// самые дешёвые, знак разности не изменится. Тогда все k! 
+	// порядков оставшихся ходов дают исход result (знак Returns()[0])
+	bool DecidedResult(const open_spiel::Action*, int, int& result) const;
+
+	// Количество порядков movesNum оставшихся ходов (movesNum!)
+	OutcomeCounter OrdersNum(int movesNum) const { return ordersNums[movesNum]; }
+
+private:
+	open_spiel::State& state;
+	const MushroomGladeInterface* gladeState;
+	int maxActionsNum;
+	std::vector<std::vector<open_spiel::Action>> actionBuffers;
+
+	// Предметы корня обхода (ценность, бит ячейки) 
+	// по убыванию ценности для каждого игрока
+	std::array<std::vector<std::pair<int, uint64_t>>, 2> bonusOrders;
+	// Наибольшая и наименьшая ценность предметов корня для каждого игрока
+	std::array<int, 2> maxBonus{}, minBonus{};
+	bool boundsReady{ false };
+	std::array<OutcomeCounter, kMaxDecidedMovesNum + 1> ordersNums;
+};
+
+
+/////////////////////StateOutcomesTree///////////////////////
+// Вычисление дерева исходов для всех состояний
+
+struct StateTree {
+	// Количесвто победных исходов для первого игрока в поддереве
+	TreeCounter winFirstPlayerSum{ 0 };  
+	// Количество победных исходов второго игрока в поддереве
+	TreeCounter winSecondPlayerSum{ 0 };
+	// Количество исходов-ничьей в поддереве
+	TreeCounter equalResultsSum{ 0 };  
+
+	// Вся поддеревья текущего состояния
+	std::map<int, std::unique_ptr<StateTree>> states;  
+
+	// Файл дерева: метка, ширина счётчиков (sizeof(TreeCounter)), 
+	// затем дерево в формате saveToBinary. Файлы без метки 
+	// записаны до её появления с 32-битными счётчиками 
+	// и не читаются сборкой с GAME_BALANCE_WIDE_TREE_COUNTERS
+	static constexpr char kFileMagic[8] = { 'S', 'T', 'R', 'E', 'E', 'B', 'I', 'N' };
+
+	void saveToFile(std::ostream& out) const {
+		uint32_t counterBytes = sizeof(TreeCounter);
+		out.write(kFileMagic, sizeof(kFileMagic));
+		out.write(reinterpret_cast<const char*>(&counterBytes), sizeof(counterBytes));
+		saveToBinary(out);
+	}
+
+	void loadFromFile(std::ifstream& in, const std::string& fileName) {
+		char magic[sizeof(kFileMagic)] = {};
+		in.read(magic, sizeof(magic));
+		if (in && std::memcmp(magic, kFileMagic, sizeof(magic)) == 0) {
+			uint32_t counterBytes = 0;
+			in.read(reinterpret_cast<char*>(&counterBytes), sizeof(counterBytes));
+			if (!in || counterBytes != sizeof(TreeCounter)) {
+				throw std::runtime_error("StateTree file has other counter width: " + fileName);
+			}
+		}
+		else {
+			if (sizeof(TreeCounter) != sizeof(int32_t)) {
+				throw std::runtime_error("StateTree file without header has 32-bit counters: " + fileName);
+			}
+			in.clear();
+			in.seekg(0);
+		}
+		loadFromBinary(in);
+	}
+
+
+	void saveToBinary(std::ostream& out) const {
+		// Сохраняем базовые поля
+		out.write(reinterpret_cast<const char*>(&winFirstPlayerSum), sizeof(winFirstPlayerSum));
+		out.write(reinterpret_cast<const char*>(&winSecondPlayerSum), sizeof(winSecondPlayerSum));
+		out.write(reinterpret_cast<const char*>(&equalResultsSum), sizeof(equalResultsSum));
+
+		// Сохраняем количество узлов
+		size_t numStates = states.size();
+		out.write(reinterpret_cast<const char*>(&numStates), sizeof(numStates));
+
+		// Сохраняем ключи и состояния
+		std::vector<int> keys;
+		keys.reserve(numStates);
+		for (const auto& [key, child] : states) {
+			keys.push_back(key);
+		}
+		out.write(reinterpret_cast<const char*>(keys.data()), keys.size() * sizeof(int));
+
+		for (const auto& [key, child] : states) {
+			child->saveToBinary(out);
+		}
+	}
+
+	void loadFromBinary(std::ifstream& in) {
+		// Загружаем базовые поля
+		in.read(reinterpret_cast<char*>(&winFirstPlayerSum), sizeof(winFirstPlayerSum));
+		in.read(reinterpret_cast<char*>(&winSecondPlayerSum), sizeof(winSecondPlayerSum));
+		in.read(reinterpret_cast<char*>(&equalResultsSum), sizeof(equalResultsSum));
+
+		// Загружаем количество узлов
+		size_t numStates;
+		in.read(reinterpret_cast<char*>(&numStates), sizeof(numStates));
+
+		// Загружаем ключи
+		std::vector<int> keys(numStates);
+		in.read(reinterpret_cast<char*>(keys.data()), keys.size() * sizeof(int));
+
+		// Загружаем состояния
+		for (size_t i = 0; i < numStates; ++i) {
+			auto child = std::make_unique<StateTree>();
+			child->loadFromBinary(in);
+			states[keys[i]] = std::move(child);
+		}
+	}
+};
+
+
+/////////////////////IndexedStateTreeFile///////////////////////
+// Файл дерева исходов с таблицей ключей корня.
+// После заголовка (счётчики корня, количество поддеревьев 
+// и смещение таблицы) идут поддеревья корня в формате 
+// StateTree::saveToBinary, в конце файла - таблица 
+// (ключ, смещение поддерева), упорядоченная по ключам.
+// По таблице читается только поддерево выбранного 
+// начального состояния, а не весь файл
+
+struct IndexedStateTreeHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t counterBytes;  // sizeof(TreeCounter) в поддеревьях
+	OutcomeCounter winFirstPlayerSum;
+	OutcomeCounter winSecondPlayerSum;
+	OutcomeCounter equalResultsSum;
+	uint64_t numStates;
+	uint64_t indexOffset;
+};
+
+struct IndexedStateTreeEntry {
+	int key;
+	uint32_t reserved;
+	uint64_t offset;
+};
+
+inline constexpr char kIndexedStateTreeMagic[8] = { 'S', 'T', 'R', 'E', 'E', 'I', 'D', 'X' };
+inline constexpr uint32_t kIndexedStateTreeVersion = 2;
+
+// Последовательная запись поддеревьев в файл с таблицей ключей.
+// Поддеревья накапливаются в буфере и попадают в файл при Flush
+class IndexedStateTreeWriter {
+public:
+	explicit IndexedStateTreeWriter(const std::string&);
+	~IndexedStateTreeWriter();
+
+	IndexedStateTreeWriter(const IndexedStateTreeWriter&) = delete;
+	IndexedStateTreeWriter& operator=(const IndexedStateTreeWriter&) = delete;
+
+	// Дописать поддерево начального состояния key в буфер, 
+	// его исходы добавляются к счётчикам корня
+	void Add(int key, const StateTree&);
+	// Записать буфер в файл
+	void Flush();
+	// Записать буфер, таблицу ключей и заголовок, закрыть файл
+	void Close();
+
+	// Размер ещё не записанных в файл данных в байтах
+	size_t BufferedBytes() const { return buffer.size(); }
+	const std::string& FileName() const { return fileName; }
+	const IndexedStateTreeHeader& GetHeader() const { return header; }
+
+private:
+	std::ofstream out;
+	std::string fileName;
+	IndexedStateTreeHeader header;
+	std::vector<IndexedStateTreeEntry> index;
+
+	std::string buffer;
+	// Смещение в файле следующего записываемого поддерева
+	uint64_t position;
+};
+
+// Чтение отдельных поддеревьев из файла с таблицей ключей
+class IndexedStateTreeFile {
+public:
+	// Читаются только заголовок и таблица ключей
+	explicit IndexedStateTreeFile(const std::string&);
+
+	// Файл начинается с заголовка IndexedStateTreeFile?
+	static bool IsIndexedFile(const std::string&);
+
+	const IndexedStateTreeHeader& GetHeader() const { return header; }
+	// Ключи начальных состояний по возрастанию
+	std::vector<int> Keys() const;
+	// Загрузить поддерево начального состояния key
+	std::unique_ptr<StateTree> LoadSubtree(int);
+
+private:
+	std::ifstream in;
+	std::string fileName;
+	IndexedStateTreeHeader header;
+	std::vector<IndexedStateTreeEntry> index;
+};
+
+// Контрольная точка записи подмножеств деревьев исходов.
+// Сохраняется после каждой записанной части начальных 
+// состояний, чтобы после сбоя продолжить с первого 
+// необработанного начального состояния
+struct SubsetCheckpoint {
+	// Суммарные счётчики подмножества по всем записанным частям
+	struct Totals {
+		std::string name;             // Название подмножества в файлах
+		uint64_t statesNum{ 0 };
+		OutcomeCounter winFirstPlayerSum{ 0 };
+		OutcomeCounter winSecondPlayerSum{ 0 };
+		OutcomeCounter equalResultsSum{ 0 };
+	};
+
+	uint64_t outcomesNum{ 0 };    // Количество начальных состояний игры
+	int slicesNum{ 0 };           // Количество частей
+	uint64_t nextOutcome{ 0 };    // Первое необработанное начальное состояние
+	std::vector<Totals> subsets;
+	std::vector<std::string> files;  // Записанные файлы подмножеств
+
+	// Запись через временный файл, чтобы 
+	// сбой во время записи не испортил прошлую точку
+	void Save(const std::string&) const;
+	// false, если контрольной точки нет
+	bool Load(const std::string&);
+};
+
+
+// Описание подмножеств деревьев исходов.
+// diff - разница между долями побед первого и второго игрока.
+// Деревья с |diff| < edges[0] относятся к подмножеству ничьей, 
+// если доля ничьих меньше drawThreshold, иначе - к подмножеству 
+// с большой долей ничьих. Остальные деревья делятся по полосам 
+// (edges[i - 1], edges[i]] для каждого игрока, деревья с |diff| 
+// больше последней границы попадают в подмножество игрока 
+// с верхней границей 100%.
+// В namePattern подставляются {side} (equal, firstPlayer, 
+// secondPlayer) и границы полосы в процентах {low}, {high}
+struct BalanceBandSpec {
+	std::vector<double> edges{ 0.01, 0.05, 0.1, 0.15, 0.2, 0.25, 0.3, 0.35, 0.4 };
+	double drawThreshold{ 0.2 };
+	std::string namePattern{ "_{side}Tree{low}_{high}.bin" };
+};
+
+// Отнесение дерева исходов к подмножеству по BalanceBandSpec
+// двоичным поиском по границам полос.
+// Номера подмножеств: 0 - ничья, 1..bands - полосы первого игрока, 
+// bands+1..2*bands - полосы второго игрока, затем подмножества 
+// с большой долей ничьих и с |diff| больше последней границы
+class BalanceClassifier {
+public:
+	explicit BalanceClassifier(const BalanceBandSpec& = BalanceBandSpec());
+
+	int BucketsNum() const { return static_cast<int>(names.size()); }
+	const std::string& BucketName(int bucket) const { return names[bucket]; }
+	const BalanceBandSpec& GetSpec() const { return spec; }
+
+	int Classify(OutcomeCounter, OutcomeCounter, OutcomeCounter) const;
+	int Classify(const StateTree& infoState) const {
+		return Classify(infoState.winFirstPlayerSum, 
+			infoState.winSecondPlayerSum, infoState.equalResultsSum);
+	}
+
+private:
+	BalanceBandSpec spec;
+	std::vector<std::string> names;
+
+	int BandsNum() const { return static_cast<int>(spec.edges.size()) - 1; }
+	int BandBucket(double) const;
+	std::string FormatName(const std::string&, double, double) const;
+};
+
+
+/////////////////////BoardSummary///////////////////////
+// Сводная таблица начальных состояний: для каждого 
+// случайного хода хранятся только количества исходов, 
+// этого достаточно, чтобы заново разбить состояния на 
+// подмножества без повторного обхода игры.
+// Формат файла: заголовок BoardSummaryHeader, затем столбцы 
+// по rowsNum элементов: actions (int), winFirstPlayerSum, 
+// winSecondPlayerSum, equalResultsSum (TreeCounter), diffs (double, 
+// по возрастанию) и order (uint32_t, номера строк в порядке diffs)
+
+struct BoardSummaryHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t counterBytes;  // sizeof(TreeCounter)
+	uint64_t rowsNum;
+};
+
+inline constexpr char kBoardSummaryMagic[8] = { 'B', 'R', 'D', 'S', 'U', 'M', 'R', 'Y' };
+inline constexpr uint32_t kBoardSummaryVersion = 2;
+
+// Строка сводной таблицы
+struct BoardSummary {
+	int action;
+	TreeCounter winFirstPlayerSum;
+	TreeCounter winSecondPlayerSum;
+	TreeCounter equalResultsSum;
+
+	// Разница между долями побед первого и второго игрока
+	double Diff() const {
+		double allRez = static_cast<double>(winFirstPlayerSum) + winSecondPlayerSum + equalResultsSum;
+		return allRez == 0 ? 0 : winFirstPlayerSum / allRez - winSecondPlayerSum / allRez;
+	}
+};
+
+// Запись сводной таблицы. Строки дописываются 
+// во временный файл fileName.rows, чтобы после сбоя 
+// восстановить уже посчитанные строки, при Close 
+// строится столбцовый файл с индексом по diff
+class BoardSummaryWriter {
+public:
+	explicit BoardSummaryWriter(const std::string&);
+
+	// Восстановить первые rowsNum строк из временного файла
+	void Restore(uint64_t);
+	void Add(int, const StateTree&);
+	// Сбросить временный файл на диск
+	void Flush();
+	void Close();
+
+private:
+	std::string fileName;
+	std::ofstream rowsOut;
+	std::vector<BoardSummary> rows;
+};
+
+// Чтение сводной таблицы и запросы по полосам diff
+class BoardSummaryFile {
+public:
+	explicit BoardSummaryFile(const std::string&);
+
+	static bool IsSummaryFile(const std::string&);
+
+	size_t RowsNum() const { return actions.size(); }
+	BoardSummary Row(size_t) const;
+
+	// Строки с low < diff <= high в порядке возрастания diff
+	std::vector<BoardSummary> Band(double, double) const;
+	// Номера случайных ходов для каждого подмножества classifier
+	std::vector<std::vector<int>> Rebucket(const BalanceClassifier&) const;
+
+private:
+	std::vector<int> actions;
+	std::vector<TreeCounter> winFirstPlayerSum;
+	std::vector<TreeCounter> winSecondPlayerSum;
+	std::vector<TreeCounter> equalResultsSum;
+	std::vector<double> diffs;
+	std::vector<uint32_t> order;
+};
+
+
+/////////////////////StateGraph///////////////////////
+// Позиция Грибной поляны в таблице позиций графа исходов: 
+// маски ячеек игроков и игрок, который ходит. 
+// Ключ фиксированной ширины, строки не выделяются
+
+struct GladePosition {
+	uint64_t crossCells;
+	uint64_t noughtCells;
+	int player;
+
+	bool operator==(const GladePosition& other) const {
+		return crossCells == other.crossCells && noughtCells == other.noughtCells 
+			&& player == other.player;
+	}
+};
+
+struct GladePositionHash {
+	size_t operator()(const GladePosition& position) const {
+		uint64_t hash = position.crossCells * 0x9E3779B97F4A7C15ull;
+		hash ^= position.noughtCells + 0x632BE59BD9B4E019ull + (hash << 6) + (hash >> 2);
+		hash ^= static_cast<uint64_t>(position.player) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+		return static_cast<size_t>(hash);
+	}
+};
+
+// Уже построенные узлы графа одного начального состояния. 
+// Позиции Грибной поляны ищутся по GladePosition, 
+// строка состояния - ключ только для остальных игр
+struct StateGraphPositions {
+	std::unordered_map<GladePosition, uint32_t, GladePositionHash> glade;
+	std::unordered_map<std::string, uint32_t> other;
+
+	void clear() {
+		glade.clear();
+		other.clear();
+	}
+};
+
+// Дерево исходов с общими поддеревьями.
+// Одинаковые позиции, полученные разными порядками ходов, 
+// хранятся одним узлом, поэтому дерево становится 
+// ориентированным ациклическим графом
+
+struct StateGraph {
+	struct Node {
+		// Количество разных исходов в поддереве узла
+		TreeCounter winFirstPlayerSum{ 0 };
+		TreeCounter winSecondPlayerSum{ 0 };
+		TreeCounter equalResultsSum{ 0 };
+		// Переходы узла: edgeActions/edgeTargets 
+		// с индексами [firstEdge, firstEdge + edgesNum)
+		uint32_t firstEdge{ 0 };
+		uint32_t edgesNum{ 0 };
+	};
+
+	// Все узлы графа, каждый общий узел хранится один раз
+	std::vector<Node> nodes;
+	// Действия переходов и номера узлов, в которые они ведут
+	std::vector<int> edgeActions;
+	std::vector<uint32_t> edgeTargets;
+	// Номер корневого узла
+	uint32_t root{ 0 };
+
+	// Развернуть поддерево узла в обычное дерево исходов
+	std::unique_ptr<StateTree> ToTree(uint32_t node) const {
+		std::unique_ptr<StateTree> infoState = std::make_unique<StateTree>();
+		const Node& current = nodes[node];
+		infoState->winFirstPlayerSum = current.winFirstPlayerSum;
+		infoState->winSecondPlayerSum = current.winSecondPlayerSum;
+		infoState->equalResultsSum = current.equalResultsSum;
+		for (uint32_t e = current.firstEdge; e < current.firstEdge + current.edgesNum; e++) {
+			infoState->states[edgeActions[e]] = ToTree(edgeTargets[e]);
+		}
+		return infoState;
+	}
+
+	void saveToBinary(std::ostream& out) const {
+		// Каждый узел записывается один раз, 
+		// переходы ссылаются на номера узлов
+		size_t numNodes = nodes.size(), numEdges = edgeActions.size();
+		out.write(reinterpret_cast<const char*>(&numNodes), sizeof(numNodes));
+		out.write(reinterpret_cast<const char*>(&root), sizeof(root));
+		out.write(reinterpret_cast<const char*>(nodes.data()), numNodes * sizeof(Node));
+
+		out.write(reinterpret_cast<const char*>(&numEdges), sizeof(numEdges));
+		out.write(reinterpret_cast<const char*>(edgeActions.data()), numEdges * sizeof(int));
+		out.write(reinterpret_cast<const char*>(edgeTargets.data()), numEdges * sizeof(uint32_t));
+	}
+
+	void loadFromBinary(std::ifstream& in) {
+		size_t numNodes, numEdges;
+		in.read(reinterpret_cast<char*>(&numNodes), sizeof(numNodes));
+		in.read(reinterpret_cast<char*>(&root), sizeof(root));
+		nodes.resize(numNodes);
+		in.read(reinterpret_cast<char*>(nodes.data()), numNodes * sizeof(Node));
+
+		in.read(reinterpret_cast<char*>(&numEdges), sizeof(numEdges));
+		edgeActions.resize(numEdges);
+		edgeTargets.resize(numEdges);
+		in.read(reinterpret_cast<char*>(edgeActions.data()), numEdges * sizeof(int));
+		in.read(reinterpret_cast<char*>(edgeTargets.data()), numEdges * sizeof(uint32_t));
+	}
+};
+
+
+/////////////////////FlatStateTree///////////////////////
+// Дерево исходов в плоском виде (compressed sparse row).
+// Узлы хранятся в порядке обхода в ширину, поэтому
+// дочерние узлы любого узла и все узлы одной глубины
+// идут подряд. Поля узлов - параллельные массивы
+// в одном блоке памяти (arena): счётчики исходов,
+// ключ узла (действие, ведущее в него) и начало
+// дочерних узлов. Дочерние узлы узла i имеют номера
+// [childOffsets[i], childOffsets[i + 1]), их ключи возрастают
+
+class FlatStateTree {
+public:
+	// Узлы одной глубины во время построения дерева.
+	// Узлы добавляются в порядке обхода в глубину -
+	// на каждой глубине он совпадает с порядком обхода в ширину
+	struct Level {
+		std::vector<int> keys;
+		std::vector<TreeCounter> winFirstPlayerSum;
+		std::vector<TreeCounter> winSecondPlayerSum;
+		std::vector<TreeCounter> equalResultsSum;
+		std::vector<uint32_t> childrenNum;
+
+		// Добавить узел, вернуть его номер на глубине
+		size_t Add(int key) {
+			keys.push_back(key);
+			winFirstPlayerSum.push_back(0);
+			winSecondPlayerSum.push_back(0);
+			equalResultsSum.push_back(0);
+			childrenNum.push_back(0);
+			return keys.size() - 1;
+		}
+	};
+	// Узлы по глубинам: levels[depth]
+	using Levels = std::vector<Level>;
+
+	class Iterator;
+
+	// Узел дерева. Лёгкий объект (дерево и номер узла),
+	// действителен, пока существует дерево
+	class Node {
+	public:
+		Node() = default;
+		Node(const FlatStateTree* tree_, uint32_t index_) : tree(tree_), index(index_) {}
+
+		// Узел существует (не результат неудачного поиска)
+		bool valid() const { return tree != nullptr; }
+		uint32_t id() const { return index; }
+
+		// Действие, ведущее в узел (-1 для корня)
+		int key() const { return tree->keys[index]; }
+		TreeCounter winFirstPlayerSum() const { return tree->winFirstPlayerSum[index]; }
+		TreeCounter winSecondPlayerSum() const { return tree->winSecondPlayerSum[index]; }
+		TreeCounter equalResultsSum() const { return tree->equalResultsSum[index]; }
+
+		// Дочерние узлы
+		size_t size() const { return tree->childOffsets[index + 1] - tree->childOffsets[index]; }
+		bool empty() const { return size() == 0; }
+		Node child(size_t i) const { return Node(tree, tree->childOffsets[index] + static_cast<uint32_t>(i)); }
+		Iterator begin() const;
+		Iterator end() const;
+		// Дочерний узел с ключом key или end() (двоичный поиск)
+		Iterator find(int key) const;
+
+	private:
+		friend class Iterator;
+		const FlatStateTree* tree{ nullptr };
+		uint32_t index{ 0 };
+	};
+
+	// Итератор по дочерним узлам одного узла
+	class Iterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Node;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const Node*;
+		using reference = const Node&;
+
+		Iterator() = default;
+		explicit Iterator(Node node_) : node(node_) {}
+
+		reference operator*() const { return node; }
+		pointer operator->() const { return &node; }
+		Iterator& operator++() { ++node.index; return *this; }
+		Iterator operator++(int) { Iterator old = *this; ++*this; return old; }
+		bool operator==(const Iterator& other) const { return node.id() == other.node.id(); }
+		bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+	private:
+		Node node;
+	};
+
+	FlatStateTree() = default;
+	FlatStateTree(FlatStateTree&&) = default;
+	FlatStateTree& operator=(FlatStateTree&&) = default;
+	FlatStateTree(const FlatStateTree&) = delete;
+	FlatStateTree& operator=(const FlatStateTree&) = delete;
+
+	// Собрать дерево из частей, построенных по глубинам.
+	// Части склеиваются по порядку на каждой глубине
+	// (например, корень и поддеревья случайных исходов),
+	// память частей освобождается по мере копирования
+	static std::unique_ptr<FlatStateTree> FromLevels(std::vector<Levels>&);
+	// Переложить обычное дерево исходов в плоский вид
+	static std::unique_ptr<FlatStateTree> FromTree(const StateTree&);
+
+	// Файл дерева: заголовок, затем массивы узлов фиксированной ширины.
+	// Смещения массивов (в байтах от начала файла) записаны в заголовке,
+	// числа хранятся в порядке байтов машины, создавшей файл
+	struct FileHeader {
+		char magic[8];
+		uint32_t version;
+		uint32_t nodesNum;
+		uint32_t levelsNum;
+		uint32_t counterBytes;  // sizeof(TreeCounter)
+		uint64_t winFirstPlayerSumOffset;
+		uint64_t winSecondPlayerSumOffset;
+		uint64_t equalResultsSumOffset;
+		uint64_t keysOffset;
+		uint64_t childOffsetsOffset;
+		uint64_t levelOffsetsOffset;
+		uint64_t fileSize;
+	};
+	static constexpr char kFileMagic[8] = { 'F', 'L', 'A', 'T', 'T', 'R', 'E', 'E' };
+	static constexpr uint32_t kFileVersion = 2;
+
+	// Записать дерево в файл
+	void SaveToFile(const std::string&) const;
+	// Отобразить файл дерева в память. Узлы читаются 
+	// прямо со страниц файла без десериализации, 
+	// страницы файла общие для всех процессов
+	static std::unique_ptr<FlatStateTree> MapFile(const std::string&);
+	// Файл начинается с заголовка FlatStateTree?
+	static bool IsFlatTreeFile(const std::string&);
+
+	Node Root() const { return Node(this, 0); }
+	bool Empty() const { return nodesNum == 0; }
+	uint32_t NodesNum() const { return nodesNum; }
+	uint32_t LevelsNum() const { return levelsNum; }
+	// Узлы глубины depth: [LevelBegin(depth), LevelEnd(depth))
+	uint32_t LevelBegin(int depth) const { return levelOffsets[depth]; }
+	uint32_t LevelEnd(int depth) const { return levelOffsets[depth + 1]; }
+	Node At(uint32_t node) const { return Node(this, node); }
+	// Действия от корня до узла. Ссылок на родителей в дереве нет, 
+	// родитель ищется двоичным поиском по смещениям детей 
+	// предыдущей глубины, поэтому путь собирается за O(depth * log n)
+	std::vector<int> PathTo(uint32_t node) const;
+
+	// Объём памяти под узлы дерева в куче 
+	// (0 для дерева, отображённого из файла)
+	size_t MemoryBytes() const { return arena.size() * sizeof(uint64_t); }
+
+private:
+	// Заголовок с непрерывным размещением массивов начиная со смещения start
+	static FileHeader MakeHeader(uint32_t nodesNum_, uint32_t levelsNum_, uint64_t start);
+	// Разметить массивы узлов по смещениям заголовка от адреса base
+	void SetSections(const char* base, const FileHeader&);
+
+	// Узлы дерева: либо arena, либо отображение файла mapping.
+	// Слова arena по 8 байт выравнивают 64-битные счётчики
+	std::vector<uint64_t> arena;
+	std::shared_ptr<const void> mapping;
+	uint32_t nodesNum{ 0 };
+	uint32_t levelsNum{ 0 };
+
+	const int* keys{ nullptr };
+	const TreeCounter* winFirstPlayerSum{ nullptr };
+	const TreeCounter* winSecondPlayerSum{ nullptr };
+	const TreeCounter* equalResultsSum{ nullptr };
+	const uint32_t* childOffsets{ nullptr };   // nodesNum + 1 элементов
+	const uint32_t* levelOffsets{ nullptr };   // levelsNum + 1 элементов
+};
+
+inline FlatStateTree::Iterator FlatStateTree::Node::begin() const {
+	return Iterator(Node(tree, tree->childOffsets[index]));
+}
+
+inline FlatStateTree::Iterator FlatStateTree::Node::end() const {
+	return Iterator(Node(tree, tree->childOffsets[index + 1]));
+}
+
+inline FlatStateTree::Iterator FlatStateTree::Node::find(int key) const {
+	const int* first = tree->keys + tree->childOffsets[index];
+	const int* last = tree->keys + tree->childOffsets[index + 1];
+	const int* it = std::lower_bound(first, last, key);
+	if (it == last || *it != key) {
+		return end();
+	}
+	return Iterator(Node(tree, static_cast<uint32_t>(it - tree->keys)));
+}
+
+
+class StateOutcomesTree {
+private:
+	std::unique_ptr<StateTree> infoStateTree;  // Дерево исходов для всех состояний
+	std::unique_ptr<StateTree> InitialStateTree(StateTraversal&, int);
+	// Поддерево решённой позиции строится по оставшимся 
+	// действиям без ходов по состоянию игры. Строятся все узлы: 
+	// их дочерние узлы нужны GameBot (см. kMaxDecidedMovesNum)
+	static std::unique_ptr<StateTree> DecidedStateTree(
+		const StateTraversal&, const open_spiel::Action*, int, int);
+
+	std::unique_ptr<StateGraph> infoStateGraph;  // Граф исходов с общими поддеревьями
+	uint32_t InitialStateGraph(StateTraversal&, int, StateGraphPositions&);
+
+	std::unique_ptr<FlatStateTree> infoFlatTree;  // Дерево исходов в плоском виде
+	void InitialFlatStateTree(StateTraversal&, int, int, FlatStateTree::Levels&);
+	BalanceClassifier balanceClassifier;  // Разбиение на подмножества для FindAndSerializeStateTree
+	void CloseSubsetFiles(
+		std::vector<std::unique_ptr<IndexedStateTreeWriter>>&,
+		SubsetCheckpoint&,
+		std::string, std::string,
+		std::string, std::string);
+public:
+	// Размер буферов файлов подмножеств по умолчанию
+	static constexpr size_t kSubsetBufferBytes = size_t{ 64 } << 20;
+
+	void SetBalanceBands(const BalanceBandSpec& spec) { balanceClassifier = BalanceClassifier(spec); }
+	void FindAndSerializeStateTree(
+		std::unique_ptr<open_spiel::State>,
+		std::string, std::string,
+		std::string, std::string,
+		std::string, int, size_t = kSubsetBufferBytes,
+		bool = false);
+	StateOutcomesTree() { 
+		infoStateTree = std::make_unique<StateTree>(); 
+		infoStateGraph = std::make_unique<StateGraph>();
+	}
+	void FindStateTree(std::unique_ptr<open_spiel::State>);
+	void FindStateTree(std::unique_ptr<open_spiel::State>, unsigned);
+	std::unique_ptr<StateTree> GetTree();
+	void SetTree(std::unique_ptr<StateTree>);
+	void Serialize(std::string);
+	void Deserialize(std::string);
+
+	void FindStateGraph(std::unique_ptr<open_spiel::State>);
+	std::unique_ptr<StateGraph> GetGraph();
+	void SerializeGraph(std::string);
+	void DeserializeGraph(std::string);
+
+	void FindFlatStateTree(std::unique_ptr<open_spiel::State>, unsigned);
+	std::unique_ptr<FlatStateTree> GetFlatTree();
+	void SerializeFlatTree(std::string);
+
+};
+
+
+/////////////////////GameAnalysis///////////////////////
+// Поиск состояний по дереву исходов
+
+class GameAnalysis {
+public:
+	virtual std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) = 0;
+	std::string GetStartedStateHistory() const;
+	std::unique_ptr<OutcomeCounter[]> GetStartedStateOutcomesNum();
+
+	// Характеристика узла для поиска, ищется наименьшая
+	virtual double StateDiff(OutcomeCounter, OutcomeCounter, OutcomeCounter) const = 0;
+
+protected:
+	int depthLimit;  // Глубина поиска по дереву исходов
+	double minDiff;  // Характеристика искомого узла дерева исходов, 
+	// минимальная разница между количеством разных исходов
+	std::unique_ptr<StateTree> optimalStartedState; // Искомый узел дерева исходов
+	std::vector<int> actionPath;     // Действия от корня до текущего узла обхода
+	std::vector<int> optimalHistory; // Действия от корня до искомого узла
+};
+
+class TreeAnalysis : public GameAnalysis {
+public:
+	std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) override;
+};
+
+// Поиск состояний для победы первого игрока
+class FirstPlayerAnalysis : public GameAnalysis {
+public:
+	std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) override;
+
+protected:
+	double StateDiff(OutcomeCounter, OutcomeCounter, OutcomeCounter) const override;
+
+private:
+	std::unique_ptr<StateTree> FirstPlayerStartedStateSearch(std::unique_ptr<StateTree>, int);
+};
+
+// Поиск состояний для победы второго игрока
+class SecondPlayerAnalysis : public GameAnalysis {
+public:
+	std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) override;
+
+protected:
+	double StateDiff(OutcomeCounter, OutcomeCounter, OutcomeCounter) const override;
+
+private:
+	std::unique_ptr<StateTree> SecondPlayerStartedStateSearch(std::unique_ptr<StateTree>, int);
+};
+
+// Поиск состояний для ничьей
+class EqualResultAnalysis : public GameAnalysis {
+public:
+	std::unique_ptr<StateTree> StartedStateSearch(std::unique_ptr<StateTree>, int) override;
+
+protected:
+	double StateDiff(OutcomeCounter, OutcomeCounter, OutcomeCounter) const override;
+
+private:
+	std::unique_ptr<StateTree> EqualResultStartedStateSearch(std::unique_ptr<StateTree>, int);
+};
+
+// Действия через запятую: "a0, a1, ..."
+std::string ActionsToString(const std::vector<int>&);
+
+// Узел, найденный поиском по нескольким целям
+struct StateCandidate {
+	double diff{ 0 };              // Значение цели, чем меньше, тем лучше
+	uint64_t order{ 0 };           // Номер узла в порядке обхода, при равенстве diff лучше меньший
+	std::vector<int> actions;      // Действия от корня до узла
+	OutcomeCounter winFirstPlayerSum{ 0 };
+	OutcomeCounter winSecondPlayerSum{ 0 };
+	OutcomeCounter equalResultsSum{ 0 };
+
+	// Действия через запятую: "a0, a1, ..."
+	std::string History() const;
+};
+
+// Поиск по нескольким целям за один обход дерева.
+// Дерево не изменяется, для каждой цели хранится куча 
+// из topK лучших узлов глубины depthLimit - 1 вместе 
+// с путями к ним. Лучший узел каждой цели совпадает 
+// с результатом поиска соответствующего класса GameAnalysis
+class MultiObjectiveAnalysis {
+public:
+	// Цели поиска
+	enum Objective { kFirstPlayer, kSecondPlayer, kEqualResult, kObjectivesNum };
+
+	explicit MultiObjectiveAnalysis(size_t topK = 1);
+
+	void StartedLevelSearch(const FlatStateTree&, int);
+	// Поиск в пуле из threadsNum потоков (0 - по количеству ядер): 
+	// глубина depthLimit - 1 плоского дерева делится на отрезки 
+	// со своими кучами, кучи отрезков сводятся по (diff, номер узла), 
+	// поэтому кандидаты совпадают с последовательным поиском
+	void StartedLevelSearch(const FlatStateTree&, int, unsigned);
+	void StartedStateSearch(const StateTree&, int);
+
+	// Найденные узлы цели от лучшего к худшему
+	const std::vector<StateCandidate>& GetCandidates(Objective objective) const { 
+		return candidates[objective]; 
+	}
+
+private:
+	// Кучи кандидатов всех целей
+	using Heaps = std::array<std::vector<StateCandidate>, kObjectivesNum>;
+
+	void Start(int);
+	// Предложить узел с номером order в порядке обхода кучам heaps, 
+	// путь actions копируется только при попадании узла в кучу
+	void Consider(Heaps&, uint64_t, OutcomeCounter, OutcomeCounter, OutcomeCounter, const std::vector<int>&) const;
+	void Finish();
+	void FlatSearch(FlatStateTree::Node, int);
+	void TreeSearch(const StateTree&, int);
+
+	size_t topK;
+	int depthLimit{ 0 };
+	uint64_t visited{ 0 };
+	std::vector<int> path;  // Действия от корня до текущего узла обхода
+	std::array<std::unique_ptr<GameAnalysis>, kObjectivesNum> objectives;
+	Heaps candidates;
+};
+
+
+/////////////////////ChanceNodeGameAnalysis///////////////////////
+
+class ChanceNodeGameAnalysis {
+private:
+	OutcomeCounter winFirstPlayer;
+	OutcomeCounter winSecondPlayer;
+	OutcomeCounter equalRezult;
+	int chanceNodeNum;
+
+	void StrategyNum(StateTraversal&, int);
+	bool PartitionStrategyNum(StateTraversal&);
+	// Предметы поляны и границы их сумм для подсчета по разделениям
+	struct SplitItems;
+	// Подсчет разделений оставшихся предметов начиная с предмета item
+	void SplitStrategyNum(const SplitItems&, int item, int moverItemsNum, int difference);
+	// Подсчет исходов для начальных состояний [begin, end) случайного узла
+	void RangeStrategyNum(open_spiel::State&, 
+		const std::vector<std::pair<open_spiel::Action, double>>&, size_t, size_t);
+
+public:
+	// Результат: победы первого, второго игрока, ничьи, количество начальных состояний
+	std::vector<OutcomeCounter> GetStrategyNum(std::unique_ptr<open_spiel::State>);
+	// Результат по частям начальных состояний. Части независимы 
+	// и считаются в пуле из threadsNum потоков (0 - по количеству ядер), 
+	// у каждой части свои счетчики, строки идут в порядке частей
+	std::vector<std::vector<OutcomeCounter>> GetSplitStrategyNum(std::unique_ptr<open_spiel::State>, int, unsigned = 0);
+};
+
+
+/////////////////////MonteCarloGameAnalysis///////////////////////
+// Оценка исходов игры со случайным корнем по случайным партиям.
+// Доска случайного узла и ходы выбираются случайно, у каждого 
+// генератора своя последовательность (seed, номер генератора), 
+// поэтому при тех же seed и количестве потоков результат повторяется.
+// В Грибной поляне количество доступных ходов зависит только 
+// от глубины, поэтому все конечные состояния равновероятны 
+// и доли исходов без смещения оценивают доли GetStrategyNum
+
+class MonteCarloGameAnalysis {
+public:
+	// Наибольшее количество партий по умолчанию
+	static constexpr uint64_t kMaxPlayouts = uint64_t{ 1 } << 32;
+	static constexpr uint64_t kDefaultSeed = 5489;
+	// Партий одного генератора между проверками точности
+	static constexpr uint64_t kBatchPlayouts = 1 << 14;
+
+	// precision - наибольшая половина ширины доверительного 
+	// интервала доли исхода, z - квантиль нормального 
+	// распределения (1.96 - 95%)
+	explicit MonteCarloGameAnalysis(double precision, double z = 1.96, 
+		uint64_t maxPlayouts = kMaxPlayouts, uint64_t seed = kDefaultSeed);
+
+	// Результат как у GetStrategyNum: победы первого, второго игрока, 
+	// ничьи в сыгранных партиях, количество начальных состояний.
+	// Партии идут в пуле из threadsNum потоков, пока не достигнута 
+	// точность precision или не сыграно maxPlayouts партий
+	std::vector<OutcomeCounter> GetStrategyEstimate(std::unique_ptr<open_spiel::State>, unsigned);
+
+	// Доля исхода (0 - победа первого игрока, 1 - второго, 2 - ничья) 
+	// и границы её доверительного интервала (интервал Уилсона)
+	double Rate(int) const;
+	double Lower(int) const;
+	double Upper(int) const;
+	uint64_t PlayoutsNum() const { return playoutsNum; }
+	bool PrecisionReached() const;
+
+private:
+	// Генератор со своим состоянием игры, 
+	// которое возвращается в корень после каждой партии
+	struct Stream {
+		std::unique_ptr<open_spiel::State> state;
+		std::unique_ptr<StateTraversal> traversal;
+		std::mt19937_64 rng;
+		std::vector<std::pair<open_spiel::Player, open_spiel::Action>> history;
+		OutcomeCounter results[3]{ 0, 0, 0 };
+	};
+	void Playouts(Stream&, uint64_t) const;
+	double HalfWidth(int) const;
+
+	double precision;
+	double z;
+	uint64_t maxPlayouts;
+	uint64_t seed;
+
+	// Количество равновероятных досок случайного корня Грибной поляны: 
+	// номер доски выбирается сразу, без списка исходов
+	uint64_t boardsNum{ 0 };
+	// Для остальных игр - исходы случайного корня 
+	// и накопленные вероятности их выбора
+	std::vector<open_spiel::Action> boards;
+	std::vector<double> boardChances;
+
+	OutcomeCounter results[3]{ 0, 0, 0 };
+	uint64_t playoutsNum{ 0 };
+};
+
+/////////////////////MinimaxSolver///////////////////////
+// Значение игры при оптимальной игре обоих игроков.
+// Поиск альфа-бета с таблицей транспозиций. Позиция Грибной 
+// поляны задаётся ячейками, занятыми каждым игроком, 
+// и игроком, который ходит: доска случайного узла 
+// на время решения одна. Для остальных игр таблица 
+// транспозиций не используется
+
+// Значение одной доски случайного узла
+struct BoardValue {
+	open_spiel::Action board{ open_spiel::kInvalidAction };     // Действие случайного узла
+	int value{ 0 };  // 1 - побеждает первый игрок, -1 - второй, 0 - ничья
+	open_spiel::Action bestMove{ open_spiel::kInvalidAction };  // Оптимальный первый ход
+	uint64_t nodesNum{ 0 };  // Количество просмотренных узлов
+};
+
+class MinimaxSolver {
+public:
+	// Значение состояния для первого игрока при оптимальной игре
+	int Solve(open_spiel::State&);
+	// Оптимальный ход игрока, который ходит в состоянии
+	open_spiel::Action BestMove(open_spiel::State&);
+	// Значения всех досок случайного корня (в пуле из threadsNum потоков).
+	// Для игры без случайного корня - одно значение с board = kInvalidAction
+	static std::vector<BoardValue> SolveBoards(const open_spiel::State&, unsigned);
+
+	// Статистика последнего Solve
+	uint64_t NodesNum() const { return nodesNum; }
+	size_t TableSize() const { return table.size(); }
+
+private:
+	// Какую оценку значения хранит запись таблицы
+	enum class Bound : int8_t { kExact, kLower, kUpper };
+	struct Entry {
+		int8_t value;
+		Bound bound;
+		open_spiel::Action bestMove;
+	};
+	// Ячейки первого и второго игрока, занятые с начала решения, 
+	// и игрок, который ходит
+	struct PositionKey {
+		uint64_t firstCells;
+		uint64_t secondCells;
+		int player;
+		bool operator==(const PositionKey& other) const {
+			return firstCells == other.firstCells && secondCells == other.secondCells && player == other.player;
+		}
+	};
+	struct PositionHash {
+		size_t operator()(const PositionKey& key) const {
+			uint64_t hash = key.firstCells * 0x9E3779B97F4A7C15ull;
+			hash ^= (key.secondCells + static_cast<uint64_t>(key.player)) * 0xC2B2AE3D27D4EB4Full;
+			return static_cast<size_t>(hash ^ (hash >> 29));
+		}
+	};
+
+	int AlphaBeta(StateTraversal&, int, int, int);
+	// Порядок ходов: ход из таблицы, затем по убыванию ценности предмета
+	const open_spiel::Action* OrderMoves(StateTraversal&, int, open_spiel::Action, int&);
+
+	std::unordered_map<PositionKey, Entry, PositionHash> table;
+	bool useTable{ false };
+	uint64_t cells[2]{ 0, 0 };
+	uint64_t nodesNum{ 0 };
+	open_spiel::Action rootBestMove{ open_spiel::kInvalidAction };
+	std::vector<std::vector<open_spiel::Action>> moveBuffers;  // По глубинам
 };
\ No newline at end of file
@@ -1,195 +1,187 @@
-#pragma once
-#include <array>
-#include <map>
-#include <memory>
-#include <string>
-#include <vector>
-
-#include "open_spiel/spiel.h"
-
-// Simple game of Noughts and Crosses:
-// https://en.wikipedia.org/wiki/Tic-tac-toe
-//
-// Parameters: none
-
-namespace open_spiel {
-    namespace MushroomGlade {
-
-        //   
-        //  
-        inline constexpr int kNumPlayers = 2;
-        //    
-        inline constexpr int kNumRows = 3;
-        //    
-        inline constexpr int kNumCols = 4;
-        //     
-        inline constexpr int kNumCells = kNumRows * kNumCols;
-        //   (   )
-        inline constexpr int kGameLength = 4;
-        inline constexpr int kBonusDif = 0;
-        //    
-        inline constexpr int kCellStates = 2 + kNumPlayers;  // '.', '1', 'o', 'x'
-
-
-        //   
-        enum class CellState {
-            kEmpty,   // .
-            kMark,    // 1
-            kNought,  // O
-            kCross,   // X
-        };
-
-        class MushroomGladeGame;
-
-        //   
-        class MushroomGladeState : public State {
-        public:
-            MushroomGladeState(std::shared_ptr<const Game> game);
-
-            MushroomGladeState(const MushroomGladeState&) = default;
-            MushroomGladeState& operator=(const MushroomGladeState&) = default;
-
-            Player CurrentPlayer() const override { 
-                //       
-                return IsTerminal() ? kTerminalPlayerId : current_player_;
-            }
-            std::string ActionToString(Player player, Action action_id) const override;
-
-            //        
-            std::vector<std::pair<Action, double>> ChanceOutcomes() const override; 
-            std::string ToString() const override;
-            
-            //      
-            bool IsTerminal() const override; 
-            
-            //   ,  -   
-            std::vector<double> Returns() const override; 
-            std::string InformationStateString(Player player) const override;
-            std::string ObservationString(Player player) const override;
-            void ObservationTensor(Player player,
-                absl::Span<float> values) const override;
-            std::unique_ptr<State> Clone() const override;
-            void UndoAction(Player player, Action move) override;
-            std::vector<Action> LegalActions() const override;
-            CellState BoardAt(int cell) const { return board_[cell]; }
-            CellState BoardAt(int row, int column) const {
-                return board_[row * kNumCols + column];
-            }
-            Player outcome() const { return outcome_; }
-
-            void SetCurrentPlayer(Player player) { current_player_ = player; }
-
-        protected:
-            // ,        
-            std::array<CellState, kNumCells> board_; 
-            //      
-            void DoApplyAction(Action move) override; 
-
-        private:
-            const MushroomGladeGame& parent_game_;
-
-            //  ?
-            bool IsWin(Player player);
-
-            //     ?
-            bool IsFull() const;
-
-            //     , 
-            //     
-            Player current_player_ = kChancePlayerId; 
-            Player outcome_ = kInvalidPlayer;
-            int num_moves_ = 0;
-
-            //     
-            std::vector<bool> boardVariant; 
-
-            //     
-            std::vector<int> actionList; 
-
-            //    
-            //    
-            int GetEarnedBonusFirstPlayer(); 
-            int GetEarnedBonusSecondPlayer(); 
-            std::vector<int> earndeBonus{ 0, 0 };
-
-            int earndeBonusFirstPlayer = 0;
-            int earndeBonusSecondPlayer = 0;
-        };
-
-        //    
-        //   
-        static void RecurInsertElementOnBoard(std::vector<bool>, int, int, int, int); 
-        static void FillBoardVariants();
-        static void FillBonusTable();
-        static void InsertElementOnBoard(std::vector<bool>, int, int, const int&, const int&);
-
-        //      
-        static int StatNumRows; //    
-        static int StatNumCols; //    
-        static int StatMaxGameLength; //   (  )
-        static int BonusDiff{kBonusDif};
-
-        //       
-        static int GetSumBonusFirstPlayer(std::vector<bool>); 
-        static int GetSumBonusSecondPlayer(std::vector<bool>);
-        static int GetBalancedPosition(int&);
-
-        //       
-        static double boardChance;
-        //   
-        static int boardVariantsNum; 
-        //     
-        //        
-        static std::vector <std::vector<bool>> boardVariants; 
-
-        static std::vector<int> bonusTable;
-        static std::vector<int> diffScale; 
-        //      
-        static std::vector<std::vector<int>> bonusTable1; 
-
-        //  
-        class MushroomGladeGame : public Game {
-        public:
-            explicit MushroomGladeGame(const GameParameters& params);
-            int NumDistinctActions() const override { return kGameLength; }
-
-            //   , 
-            //       
-            std::unique_ptr<State> NewInitialState() const override { 
-                if (boardVariants.empty()) {
-                    FillBonusTable();
-                    FillBoardVariants();
-                }
-                return std::unique_ptr<State>(new MushroomGladeState(shared_from_this()));
-            }
-            //   
-            int NumPlayers() const override { return kNumPlayers; }
-            //   
-            double MinUtility() const override { return -1; }
-            absl::optional<double> UtilitySum() const override { return 0; }
-            //  
-            double MaxUtility() const override { return 1; }
-            std::vector<int> ObservationTensorShape() const override {
-                return { kCellStates, kNumRows, kNumCols };
-            }
-
-            //    
-            int MaxGameLength() const override { return max_game_length_; } 
-            std::string ActionToString(Player player, Action action_id) const override;
-
-        private:
-            const int max_game_length_;
-        };
-
-        //    
-        CellState PlayerToState(Player player);
-        //      
-        std::string StateToString(CellState state);
-
-
-        inline std::ostream& operator<<(std::ostream& stream, const CellState& state) {
-            return stream << StateToString(state);
-        }
-
-    }  // namespace 
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open_spiel/spiel.h"
+#include "../MushroomGladeInterface/MushroomGladeInterface.h"
+#include "../BoardCombinations/BoardCombinations.h"
+
+// Грибная поляна с размером поля, заданным параметрами игры.
+// Поле хранится в трёх 64-битных масках (ячейки с предметами,
+// ячейки первого и второго игрока), поэтому в одной игре
+// может быть не больше 64 ячеек. Карты ценностей и нумерация
+// начальных досок строятся в конструкторе объекта игры
+// под его rows_num, cols_num и max_game_length, так что
+// игры разных размеров работают в одном процессе одновременно.
+// При параметрах по умолчанию (3x4x4) номера действий
+// совпадают с mushroom_glade_3x4x4
+//
+// Parameters: max_game_length, bonus_diff, rows_num, cols_num
+
+namespace open_spiel {
+    namespace MushroomGlade {
+
+        // Заданные игровые параметры
+        // Количество игроков
+        inline constexpr int kNumPlayers = 2;
+        // Количество строк игрового поля по умолчанию
+        inline constexpr int kNumRows = 3;
+        // Количество стролбцов игрового поля по умолчанию
+        inline constexpr int kNumCols = 4;
+        // Длина игры (количество предметов на поле) по умолчанию
+        inline constexpr int kGameLength = 4;
+        inline constexpr int kBonusDif = 0;
+        // Наибольшее количество ячеек поля (размер маски)
+        inline constexpr int kMaxNumCells = 64;
+        // Количество различных состояний ячейки
+        inline constexpr int kCellStates = 2 + kNumPlayers;  // '.', '1', 'o', 'x'
+
+
+        // Состояние ячейки поля
+        enum class CellState {
+            kEmpty,   // .
+            kMark,    // 1
+            kNought,  // O
+            kCross,   // X
+        };
+
+        class MushroomGladeGame;
+
+        // Объект состояния игры
+        class MushroomGladeState : public State, public MushroomGladeInterface {
+        public:
+            MushroomGladeState(std::shared_ptr<const Game> game);
+
+            MushroomGladeState(const MushroomGladeState&) = default;
+            MushroomGladeState& operator=(const MushroomGladeState&) = default;
+
+            Player CurrentPlayer() const override {
+                // Какой игрок ходит на текущем состоянии игры
+                return IsTerminal() ? kTerminalPlayerId : current_player_;
+            }
+            std::string ActionToString(Player player, Action action_id) const override;
+
+            // Список элементов для выбора в случайном узле
+            std::vector<std::pair<Action, double>> ChanceOutcomes() const override;
+            std::string ToString() const override;
+
+            // Ялвяется ли конечным текущее состояние игры
+            bool IsTerminal() const override;
+
+            // Показать результаты игры, значения ф-ции полезности для игроков
+            std::vector<double> Returns() const override;
+            std::string InformationStateString(Player player) const override;
+            std::string ObservationString(Player player) const override;
+            void ObservationTensor(Player player,
+                absl::Span<float> values) const override;
+            std::unique_ptr<State> Clone() const override;
+            void UndoAction(Player player, Action move) override;
+            std::vector<Action> LegalActions() const override;
+
+            // Обход дерева игры без копирования состояний
+            int LegalActionsInto(Action* moves) const override;
+            int MaxLegalActionsNum() const override;
+            int FirstPlayerResult() const override;
+            int ItemBonus(Player player, Action cell) const override;
+            int EarnedBonus(Player player) const override;
+            int MovesLeft() const override;
+            uint64_t PlayerCells(Player player) const override;
+            uint64_t BoardsNum() const override;
+
+            // Состояние ячейки по битовым маскам
+            CellState BoardAt(int cell) const;
+            CellState BoardAt(int row, int column) const;
+
+        protected:
+            // Выбрать действие игрока для текущего состояния
+            void DoApplyAction(Action move) override;
+
+        private:
+            const MushroomGladeGame& parent_game_;
+
+            // Свободные предметы на доске закончились?
+            bool IsFull() const;
+
+            // Игра начинается со случайного узла,
+            // который выбирает начальное состояние доски
+            Player current_player_ = kChancePlayerId;
+            int num_moves_ = 0;
+
+            // Ячейки со свободными предметами
+            uint64_t markedCells = 0;
+            // Ячейки, занятые первым игроком
+            uint64_t crossCells = 0;
+            // Ячейки, занятые вторым игроком
+            uint64_t noughtCells = 0;
+
+            // Суммарная стоимость взятых игроками предметов
+            std::array<int, kNumPlayers> earndeBonus{ 0, 0 };
+        };
+
+        // Объект игры
+        class MushroomGladeGame : public Game {
+        public:
+            explicit MushroomGladeGame(const GameParameters& params);
+            int NumDistinctActions() const override { return NumCells(); }
+
+            // Таблицы игры уже построены в конструкторе
+            std::unique_ptr<State> NewInitialState() const override {
+                return std::unique_ptr<State>(new MushroomGladeState(shared_from_this()));
+            }
+            // Количество игроков игры
+            int NumPlayers() const override { return kNumPlayers; }
+            // Минимальный выигрыш
+            double MinUtility() const override { return -1; }
+            absl::optional<double> UtilitySum() const override { return 0; }
+            // Максимальный выигрыш
+            double MaxUtility() const override { return 1; }
+            std::vector<int> ObservationTensorShape() const override {
+                return { kCellStates, num_rows_, num_cols_ };
+            }
+
+            // Количество ходов в игре
+            int MaxGameLength() const override { return max_game_length_; }
+            std::string ActionToString(Player player, Action action_id) const override;
+
+            // Размер игрового поля
+            int NumRows() const { return num_rows_; }
+            int NumCols() const { return num_cols_; }
+            int NumCells() const { return num_rows_ * num_cols_; }
+            int BonusDiff() const { return bonus_diff_; }
+
+        private:
+            friend class MushroomGladeState;
+
+            // Заполнить карты ценностей предметов для двух игроков
+            void FillBonusTable();
+
+            const int max_game_length_;
+            const int bonus_diff_;
+            const int num_rows_;
+            const int num_cols_;
+
+            // Нумерация начальных состояний: маска
+            // ячеек с предметами по номеру действия
+            const BoardCombinations boardCombinations;
+            // Шанс выбора одного их состояний в игре
+            const double boardChance;
+
+            // Карты ценностей предметов для двух игроков
+            std::array<std::array<int, kMaxNumCells>, kNumPlayers> bonusTables{};
+        };
+
+        // Состояния ячейки определенного игрока
+        CellState PlayerToState(Player player);
+        // Состояние игровой доски в сточном виде
+        std::string StateToString(CellState state);
+
+
+        inline std::ostream& operator<<(std::ostream& stream, const CellState& state) {
+            return stream << StateToString(state);
+        }
+
+    }  // namespace
 }  // namespace open_spiel
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "open_spiel/spiel.h"
+
+// Дополнительный интерфейс состояний всех вариантов Грибной поляны.
+// Через него алгоритмы анализа (GameAnalysis) обходят дерево игры
+// на одном изменяемом состоянии без выделения памяти в каждом узле
+
+class MushroomGladeInterface {
+public:
+    virtual ~MushroomGladeInterface() = default;
+
+    // Записать доступные действия в буфер moves
+    // (не меньше MaxLegalActionsNum() элементов),
+    // вернуть количество записанных действий
+    virtual int LegalActionsInto(open_spiel::Action* moves) const = 0;
+
+    // Наибольшее количество доступных действий в одном состоянии
+    virtual int MaxLegalActionsNum() const = 0;
+
+    // Результат игры для первого игрока в конечном состоянии:
+    // 1 - победа, -1 - поражение, 0 - ничья (как Returns()[0])
+    virtual int FirstPlayerResult() const = 0;
+
+    // Ценность предмета в ячейке cell для игрока player
+    virtual int ItemBonus(open_spiel::Player player, open_spiel::Action cell) const = 0;
+
+    // Суммарная ценность предметов, уже взятых игроком player
+    virtual int EarnedBonus(open_spiel::Player player) const = 0;
+
+    // Количество ходов до конца игры
+    virtual int MovesLeft() const = 0;
+
+    // Ячейки, занятые игроком player, битовой маской (ячейка cell - бит cell).
+    // Вместе с игроком, который ходит, задают позицию одного начального состояния
+    virtual uint64_t PlayerCells(open_spiel::Player player) const = 0;
+
+    // Количество начальных досок. Исходы случайного корня равновероятны
+    // и совпадают с номерами досок 0..BoardsNum()-1, поэтому доску
+    // можно выбрать без списка ChanceOutcomes()
+    virtual uint64_t BoardsNum() const = 0;
+};
+
+// Количество единичных битов маски ячеек поля
+inline int CountBits(uint64_t mask) {
+#ifdef _MSC_VER
+    return static_cast<int>(__popcnt64(mask));
+#else
+    return __builtin_popcountll(mask);
+#endif
+}
+
+// Номер младшего единичного бита непустой маски ячеек поля
+inline int LowestBit(uint64_t mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(mask);
+#endif
+}
\ No newline at end of file
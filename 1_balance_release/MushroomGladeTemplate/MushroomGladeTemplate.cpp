@@ -0,0 +1,345 @@
+#include "MushroomGladeTemplate.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/tensor_view.h"
+
+namespace open_spiel {
+    namespace MushroomGladeTemplate {
+
+        // Состояние игрока на доске
+        CellState PlayerToState(Player player) {
+            switch (player) {
+            case 0:
+                return CellState::kCross;
+            case 1:
+                return CellState::kNought;
+            default:
+                SpielFatalError(absl::StrCat("Invalid player id ", player));
+                return CellState::kEmpty;
+            }
+        }
+
+        // Состояние игрока на доске для вывода
+        std::string StateToString(CellState state) {
+            switch (state) {
+            case CellState::kEmpty:
+                return ".";
+            case CellState::kMark:
+                return "1";
+            case CellState::kNought:
+                return "o";
+            case CellState::kCross:
+                return "x";
+            default:
+                SpielFatalError("Unknown state.");
+            }
+        }
+
+
+        // Добавить действие. Перевести игру в следующее состояние
+        template <int Rows, int Cols, int Length>
+        void MushroomGladeState<Rows, Cols, Length>::DoApplyAction(Action move) {
+            if (IsChanceNode()) {
+                // Доска восстанавливается по номеру действия, её ячейки
+                // перебираются по возрастанию, поэтому список действий
+                // получается отсортированным
+                uint64_t cells = parent_game_.boardCombinations.Unrank(move);
+                for (int cell = 0; cell < kNumCells; cell++) {
+                    if (cells & (uint64_t{ 1 } << cell)) {
+                        board_[cell] = CellState::kMark;
+                        actionList[actionsNum++] = cell;
+                    }
+                }
+                current_player_ = 0;
+            }
+            else {
+                SPIEL_CHECK_EQ(board_[move], CellState::kMark);
+                board_[move] = PlayerToState(current_player_);
+
+                // Номер ячейки убирается из списка со сдвигом хвоста
+                auto end = actionList.begin() + actionsNum;
+                auto position = std::find(actionList.begin(), end, move);
+                std::copy(position + 1, end, position);
+                --actionsNum;
+
+                earndeBonus[current_player_] += kBonusTables[current_player_][move];
+                current_player_ = 1 - current_player_;
+                num_moves_ += 1;
+            }
+        }
+
+        template <int Rows, int Cols, int Length>
+        std::vector<std::pair<Action, double>> MushroomGladeState<Rows, Cols, Length>::ChanceOutcomes() const {
+            SPIEL_CHECK_TRUE(IsChanceNode());
+            uint64_t boardsNum = parent_game_.boardCombinations.Size();
+            std::vector<std::pair<Action, double>> outcomes;
+
+            outcomes.reserve(boardsNum);
+            for (uint64_t i = 0; i < boardsNum; i++) {
+                outcomes.push_back(std::make_pair(i, parent_game_.boardChance));
+            }
+
+            return outcomes;
+        }
+
+        // Список доступных действий (ячейки со свободными предметами)
+        template <int Rows, int Cols, int Length>
+        std::vector<Action> MushroomGladeState<Rows, Cols, Length>::LegalActions() const {
+            if (IsTerminal()) return {};
+            return std::vector<Action>(actionList.begin(), actionList.begin() + actionsNum);
+        }
+
+        // Доступные действия без выделения памяти
+        template <int Rows, int Cols, int Length>
+        int MushroomGladeState<Rows, Cols, Length>::LegalActionsInto(Action* moves) const {
+            if (IsTerminal()) return 0;
+            std::copy(actionList.begin(), actionList.begin() + actionsNum, moves);
+            return actionsNum;
+        }
+
+        template <int Rows, int Cols, int Length>
+        int MushroomGladeState<Rows, Cols, Length>::MaxLegalActionsNum() const {
+            return parent_game_.MaxGameLength();
+        }
+
+        // Знак Returns()[0] без выделения памяти
+        template <int Rows, int Cols, int Length>
+        int MushroomGladeState<Rows, Cols, Length>::FirstPlayerResult() const {
+            return (earndeBonus[0] > earndeBonus[1]) - (earndeBonus[0] < earndeBonus[1]);
+        }
+
+        template <int Rows, int Cols, int Length>
+        int MushroomGladeState<Rows, Cols, Length>::ItemBonus(Player player, Action cell) const {
+            return kBonusTables[player][cell];
+        }
+
+        template <int Rows, int Cols, int Length>
+        int MushroomGladeState<Rows, Cols, Length>::EarnedBonus(Player player) const {
+            return earndeBonus[player];
+        }
+
+        template <int Rows, int Cols, int Length>
+        int MushroomGladeState<Rows, Cols, Length>::MovesLeft() const {
+            return parent_game_.MaxGameLength() - num_moves_;
+        }
+
+        // Маска собирается по доске, отдельные маски игроков не хранятся
+        template <int Rows, int Cols, int Length>
+        uint64_t MushroomGladeState<Rows, Cols, Length>::PlayerCells(Player player) const {
+            CellState playerState = PlayerToState(player);
+            uint64_t cells = 0;
+            for (int cell = 0; cell < kNumCells; cell++) {
+                if (board_[cell] == playerState) {
+                    cells |= uint64_t{ 1 } << cell;
+                }
+            }
+            return cells;
+        }
+
+        template <int Rows, int Cols, int Length>
+        uint64_t MushroomGladeState<Rows, Cols, Length>::BoardsNum() const {
+            return parent_game_.boardCombinations.Size();
+        }
+
+        template <int Rows, int Cols, int Length>
+        std::string MushroomGladeState<Rows, Cols, Length>::ActionToString(Player player,
+            Action action_id) const {
+            return game_->ActionToString(player, action_id);
+        }
+
+        // Доска заполнена?
+        template <int Rows, int Cols, int Length>
+        bool MushroomGladeState<Rows, Cols, Length>::IsFull() const {
+            return num_moves_ == parent_game_.MaxGameLength();
+        }
+
+        // Конструктор состояния. Доска пуста до случайного хода
+        template <int Rows, int Cols, int Length>
+        MushroomGladeState<Rows, Cols, Length>::MushroomGladeState(std::shared_ptr<const Game> game)
+            : State(game),
+            parent_game_(open_spiel::down_cast<const MushroomGladeGame<Rows, Cols, Length>&>(*game)) {
+            std::fill(begin(board_), end(board_), CellState::kEmpty);
+        }
+
+        // Текущее состояние доски в строковом виде
+        template <int Rows, int Cols, int Length>
+        std::string MushroomGladeState<Rows, Cols, Length>::ToString() const {
+            std::string str;
+            for (int r = 0; r < kNumRows; ++r) {
+                for (int c = 0; c < kNumCols; ++c) {
+                    absl::StrAppend(&str, StateToString(BoardAt(r, c)));
+                }
+                if (r < (kNumRows - 1)) {
+                    absl::StrAppend(&str, "\n");
+                }
+            }
+            return str;
+        }
+
+        // Состояние конечное?
+        template <int Rows, int Cols, int Length>
+        bool MushroomGladeState<Rows, Cols, Length>::IsTerminal() const {
+            return IsFull();
+        }
+
+        // Выигрыши игроков
+        template <int Rows, int Cols, int Length>
+        std::vector<double> MushroomGladeState<Rows, Cols, Length>::Returns() const {
+            switch (FirstPlayerResult()) {
+            case 1:
+                return { 1.0, -1.0 };
+            case -1:
+                return { -1.0, 1.0 };
+            default:
+                return { 0.0, 0.0 };
+            }
+        }
+
+        template <int Rows, int Cols, int Length>
+        std::string MushroomGladeState<Rows, Cols, Length>::InformationStateString(Player player) const {
+            SPIEL_CHECK_GE(player, 0);
+            SPIEL_CHECK_LT(player, num_players_);
+            return HistoryString();
+        }
+
+        template <int Rows, int Cols, int Length>
+        std::string MushroomGladeState<Rows, Cols, Length>::ObservationString(Player player) const {
+            SPIEL_CHECK_GE(player, 0);
+            SPIEL_CHECK_LT(player, num_players_);
+            return ToString();
+        }
+
+        template <int Rows, int Cols, int Length>
+        void MushroomGladeState<Rows, Cols, Length>::ObservationTensor(Player player,
+            absl::Span<float> values) const {
+            SPIEL_CHECK_GE(player, 0);
+            SPIEL_CHECK_LT(player, num_players_);
+
+            // `values` - двумерный тензор
+            TensorView<2> view(values, { kCellStates, kNumCells }, true);
+            for (int cell = 0; cell < kNumCells; ++cell) {
+                view[{static_cast<int>(board_[cell]), cell}] = 1.0;
+            }
+        }
+
+        template <int Rows, int Cols, int Length>
+        void MushroomGladeState<Rows, Cols, Length>::UndoAction(Player player, Action move) {
+            if (player == kChancePlayerId) {
+                std::fill(begin(board_), end(board_), CellState::kEmpty);
+                actionsNum = 0;
+            }
+            else {
+                board_[move] = CellState::kMark;
+
+                // Номер ячейки возвращается на своё место в списке
+                auto end = actionList.begin() + actionsNum;
+                auto position = std::lower_bound(actionList.begin(), end, move);
+                std::copy_backward(position, end, end + 1);
+                *position = move;
+                ++actionsNum;
+
+                earndeBonus[player] -= kBonusTables[player][move];
+                num_moves_ -= 1;
+            }
+            current_player_ = player;
+            history_.pop_back();
+            --move_number_;
+        }
+
+        template <int Rows, int Cols, int Length>
+        std::unique_ptr<State> MushroomGladeState<Rows, Cols, Length>::Clone() const {
+            return std::unique_ptr<State>(new MushroomGladeState(*this));
+        }
+
+        template <int Rows, int Cols, int Length>
+        const GameType& MushroomGladeGame<Rows, Cols, Length>::StaticGameType() {
+            static const GameType gameType{
+                /*short_name=*/absl::StrCat("mushroom_glade_", Rows, "x", Cols, "x", Length),
+                /*long_name=*/absl::StrCat("Mushroom Glade ", Rows, "x", Cols, "x", Length),
+                GameType::Dynamics::kSequential,
+                GameType::ChanceMode::kExplicitStochastic,
+                GameType::Information::kPerfectInformation,
+                GameType::Utility::kZeroSum,
+                GameType::RewardModel::kTerminal,
+                /*max_num_players=*/2,
+                /*min_num_players=*/2,
+                /*provides_information_state_string=*/true,
+                /*provides_information_state_tensor=*/false,
+                /*provides_observation_string=*/true,
+                /*provides_observation_tensor=*/true,
+                /*parameter_specification=*/{
+                    {"max_game_length", GameParameter(Length)},
+                    {"bonus_diff", GameParameter(kBonusDif)},
+                    {"rows_num", GameParameter(Rows)},
+                    {"cols_num", GameParameter(Cols)}
+                }
+            };
+            return gameType;
+        }
+
+        template <int Rows, int Cols, int Length>
+        std::string MushroomGladeGame<Rows, Cols, Length>::ActionToString(Player player,
+            Action action_id) const {
+            return absl::StrCat(StateToString(PlayerToState(player)), "(",
+                action_id / Cols, ",", action_id % Cols, ")");
+        }
+
+        template <int Rows, int Cols, int Length>
+        MushroomGladeGame<Rows, Cols, Length>::MushroomGladeGame(const GameParameters& params)
+            : Game(StaticGameType(), params),
+            max_game_length_(ParameterValue<int>("max_game_length", Length)),
+            bonus_diff_(ParameterValue<int>("bonus_diff", kBonusDif)),
+            boardCombinations(StateType::kNumCells, max_game_length_),
+            boardChance(1.0 / boardCombinations.Size()) {
+            SPIEL_CHECK_GE(max_game_length_, 1);
+            SPIEL_CHECK_LE(max_game_length_, StateType::kNumCells);
+        }
+
+        namespace {
+
+            template <int Rows, int Cols, int Length>
+            std::shared_ptr<const Game> Factory(const GameParameters& params) {
+                return std::shared_ptr<const Game>(new MushroomGladeGame<Rows, Cols, Length>(params));
+            }
+
+            // Регистрация варианта игры в списке зарегистрированных игр
+            template <int Rows, int Cols, int Length>
+            class GameRegistration {
+            public:
+                GameRegistration()
+                    : gameRegisterer(MushroomGladeGame<Rows, Cols, Length>::StaticGameType(),
+                        Factory<Rows, Cols, Length>),
+                    observerRegisterer(MushroomGladeGame<Rows, Cols, Length>::StaticGameType().short_name) {
+                }
+
+            private:
+                GameRegisterer gameRegisterer;
+                RegisterSingleTensorObserver observerRegisterer;
+            };
+
+        }  // namespace
+
+// Явное инстанцирование и регистрация варианта "mushroom_glade_RxCxL"
+#define REGISTER_MUSHROOM_GLADE(ROWS, COLS, LENGTH)                                        \
+        template class MushroomGladeState<ROWS, COLS, LENGTH>;                             \
+        template class MushroomGladeGame<ROWS, COLS, LENGTH>;                              \
+        namespace {                                                                        \
+            GameRegistration<ROWS, COLS, LENGTH> registration##ROWS##x##COLS##x##LENGTH;   \
+        }
+
+        // Зарегистрированные варианты: строки, столбцы, длина игры
+        REGISTER_MUSHROOM_GLADE(3, 4, 4)
+        REGISTER_MUSHROOM_GLADE(3, 4, 6)
+        REGISTER_MUSHROOM_GLADE(3, 6, 6)
+        REGISTER_MUSHROOM_GLADE(5, 4, 6)
+        REGISTER_MUSHROOM_GLADE(5, 6, 6)
+
+#undef REGISTER_MUSHROOM_GLADE
+
+    }  // namespace MushroomGladeTemplate
+}  // namespace open_spiel
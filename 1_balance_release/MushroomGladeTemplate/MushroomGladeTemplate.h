@@ -0,0 +1,195 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open_spiel/spiel.h"
+#include "../MushroomGladeInterface/MushroomGladeInterface.h"
+#include "../BoardCombinations/BoardCombinations.h"
+
+// Грибная поляна с размером поля и длиной игры, заданными
+// параметрами шаблона MushroomGladeGame<Rows, Cols, Length>.
+// Карты ценностей предметов считаются на этапе компиляции,
+// список доступных действий хранится в массиве фиксированного
+// размера, поэтому состояние не выделяет память после создания,
+// начальная доска восстанавливается по номеру действия случайного узла.
+// Варианты регистрируются явными инстанцированиями
+// в MushroomGladeTemplate.cpp (по одной строке на вариант),
+// правила, номера действий и порядок начальных досок совпадают
+// с прежними отдельными реализациями mushroom_glade_RxCxL
+//
+// Parameters: max_game_length, bonus_diff, rows_num, cols_num
+// (rows_num и cols_num принимаются для совместимости,
+// размер поля задаётся параметрами шаблона)
+
+namespace open_spiel {
+    namespace MushroomGladeTemplate {
+
+        // Количество игроков
+        inline constexpr int kNumPlayers = 2;
+        inline constexpr int kBonusDif = 0;
+        // Количество различных состояний ячейки
+        inline constexpr int kCellStates = 2 + kNumPlayers;  // '.', '1', 'o', 'x'
+
+        // Состояние ячейки поля
+        enum class CellState {
+            kEmpty,   // .
+            kMark,    // 1
+            kNought,  // O
+            kCross,   // X
+        };
+
+        // Карты ценностей предметов для двух игроков.
+        // Ценность первого игрока растёт к центральной строке
+        // и к левому краю поля, карта второго игрока получается
+        // вычитанием разницы ценностей крайних столбцов первой строки
+        // (то есть отражением карты первого игрока по столбцам)
+        template <int Rows, int Cols>
+        constexpr std::array<std::array<int, Rows * Cols>, kNumPlayers> MakeBonusTables() {
+            std::array<std::array<int, Rows * Cols>, kNumPlayers> tables{};
+            constexpr int centralRowIndex = Rows / 2;
+            for (int r = 0; r < Rows; r++) {
+                int rowDistance = centralRowIndex > r ? centralRowIndex - r : r - centralRowIndex;
+                for (int c = 0; c < Cols; c++) {
+                    tables[0][r * Cols + c] = Rows - rowDistance + Cols - c;
+                }
+            }
+            for (int cell = 0; cell < Rows * Cols; cell++) {
+                int c = cell % Cols;
+                tables[1][cell] = tables[0][cell] - (tables[0][c] - tables[0][Cols - 1 - c]);
+            }
+            return tables;
+        }
+
+        template <int Rows, int Cols, int Length>
+        class MushroomGladeGame;
+
+        // Объект состояния игры
+        template <int Rows, int Cols, int Length>
+        class MushroomGladeState : public State, public MushroomGladeInterface {
+        public:
+            static constexpr int kNumRows = Rows;
+            static constexpr int kNumCols = Cols;
+            static constexpr int kNumCells = Rows * Cols;
+
+            static_assert(Rows > 0 && Cols > 0, "Board must not be empty");
+            static_assert(kNumCells <= 64, "Board must fit into a 64-bit mask");
+            static_assert(Length > 0 && Length <= kNumCells, "Game length must not exceed the board size");
+
+            // Карты ценностей предметов, посчитанные при компиляции
+            static constexpr std::array<std::array<int, kNumCells>, kNumPlayers> kBonusTables =
+                MakeBonusTables<Rows, Cols>();
+
+            MushroomGladeState(std::shared_ptr<const Game> game);
+
+            MushroomGladeState(const MushroomGladeState&) = default;
+            MushroomGladeState& operator=(const MushroomGladeState&) = default;
+
+            Player CurrentPlayer() const override {
+                return IsTerminal() ? kTerminalPlayerId : current_player_;
+            }
+            std::string ActionToString(Player player, Action action_id) const override;
+            std::vector<std::pair<Action, double>> ChanceOutcomes() const override;
+            std::string ToString() const override;
+            bool IsTerminal() const override;
+            std::vector<double> Returns() const override;
+            std::string InformationStateString(Player player) const override;
+            std::string ObservationString(Player player) const override;
+            void ObservationTensor(Player player,
+                absl::Span<float> values) const override;
+            std::unique_ptr<State> Clone() const override;
+            void UndoAction(Player player, Action move) override;
+            std::vector<Action> LegalActions() const override;
+
+            // Обход дерева игры без копирования состояний
+            int LegalActionsInto(Action* moves) const override;
+            int MaxLegalActionsNum() const override;
+            int FirstPlayerResult() const override;
+            int ItemBonus(Player player, Action cell) const override;
+            int EarnedBonus(Player player) const override;
+            int MovesLeft() const override;
+            uint64_t PlayerCells(Player player) const override;
+            uint64_t BoardsNum() const override;
+
+            CellState BoardAt(int cell) const { return board_[cell]; }
+            CellState BoardAt(int row, int column) const {
+                return board_[row * kNumCols + column];
+            }
+
+        protected:
+            // Доска, на которой выбираются предметы
+            std::array<CellState, kNumCells> board_;
+            void DoApplyAction(Action move) override;
+
+        private:
+            const MushroomGladeGame<Rows, Cols, Length>& parent_game_;
+
+            // Свободные предметы на доске закончились?
+            bool IsFull() const;
+
+            // Игра начинается со случайного узла,
+            // который выбирает начальное состояние доски
+            Player current_player_ = kChancePlayerId;
+            int num_moves_ = 0;
+
+            // Отсортированный список ячеек со свободными предметами
+            std::array<uint8_t, kNumCells> actionList;
+            int actionsNum = 0;
+
+            // Суммарная ценность взятых игроками предметов
+            std::array<int, kNumPlayers> earndeBonus{ 0, 0 };
+        };
+
+        // Объект игры
+        template <int Rows, int Cols, int Length>
+        class MushroomGladeGame : public Game {
+        public:
+            using StateType = MushroomGladeState<Rows, Cols, Length>;
+
+            // Описание варианта игры: "mushroom_glade_RxCxL"
+            static const GameType& StaticGameType();
+
+            explicit MushroomGladeGame(const GameParameters& params);
+            int NumDistinctActions() const override { return StateType::kNumCells; }
+
+            std::unique_ptr<State> NewInitialState() const override {
+                return std::unique_ptr<State>(new StateType(shared_from_this()));
+            }
+            int NumPlayers() const override { return kNumPlayers; }
+            double MinUtility() const override { return -1; }
+            absl::optional<double> UtilitySum() const override { return 0; }
+            double MaxUtility() const override { return 1; }
+            std::vector<int> ObservationTensorShape() const override {
+                return { kCellStates, Rows, Cols };
+            }
+            int MaxGameLength() const override { return max_game_length_; }
+            std::string ActionToString(Player player, Action action_id) const override;
+
+            int BonusDiff() const { return bonus_diff_; }
+
+        private:
+            friend StateType;
+
+            const int max_game_length_;
+            const int bonus_diff_;
+
+            // Нумерация начальных состояний: маска
+            // ячеек с предметами по номеру действия
+            const BoardCombinations boardCombinations;
+            // Шанс выбора одного их состояний в игре
+            const double boardChance;
+        };
+
+        // Состояния ячейки определенного игрока
+        CellState PlayerToState(Player player);
+        // Состояние игровой доски в сточном виде
+        std::string StateToString(CellState state);
+
+        inline std::ostream& operator<<(std::ostream& stream, const CellState& state) {
+            return stream << StateToString(state);
+        }
+
+    }  // namespace MushroomGladeTemplate
+}  // namespace open_spiel
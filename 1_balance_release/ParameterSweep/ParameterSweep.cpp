@@ -0,0 +1,221 @@
+#include "ParameterSweep.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "../MushroomGlade/MushroomGlade.h"
+
+namespace {
+
+	// Вариант с размером поля из параметров rows_num/cols_num
+	const std::string kRuntimeGame = "mushroom_glade";
+
+	// Форма доски и длина игры варианта Грибной поляны 
+	// по значениям параметров по умолчанию. Подходят только 
+	// варианты, объявляющие rows_num/cols_num: у остальных 
+	// (mushroom_glade_4x6) другие правила, а не другой размер поля
+	bool GladeShape(const open_spiel::GameType& type, int& rowsNum, int& colsNum, int& gameLength) {
+		const std::string prefix = "mushroom_glade";
+		if (type.short_name.compare(0, prefix.size(), prefix) != 0) {
+			return false;
+		}
+		const auto& spec = type.parameter_specification;
+		auto length = spec.find("max_game_length");
+		if (length == spec.end()) {
+			return false;
+		}
+		gameLength = length->second.int_value();
+
+		auto rows = spec.find("rows_num");
+		auto cols = spec.find("cols_num");
+		if (rows == spec.end() || cols == spec.end()) {
+			return false;
+		}
+		rowsNum = rows->second.int_value();
+		colsNum = cols->second.int_value();
+		return true;
+	}
+
+}  // namespace
+
+ParameterSweep::ParameterSweep(const std::vector<int>& rowsNums, const std::vector<int>& colsNums,
+	const std::vector<int>& gameLengths, const std::vector<int>& bonusDiffs) {
+	for (int rowsNum : rowsNums) {
+		for (int colsNum : colsNums) {
+			for (int gameLength : gameLengths) {
+				for (int bonusDiff : bonusDiffs) {
+					configs.push_back(SweepConfig{ rowsNum, colsNum, gameLength, bonusDiff });
+				}
+			}
+		}
+	}
+}
+
+std::string ParameterSweep::ResolveGame(const SweepConfig& config, open_spiel::GameParameters& params) {
+
+	// Сначала ищется вариант с точным названием, затем любой 
+	// вариант с такой же формой доски и длиной игры по умолчанию. 
+	// Длина игры не меняется параметром: таблицы досок варианта 
+	// заполняются один раз и рассчитаны на длину по умолчанию. 
+	// Если такого варианта нет, берётся mushroom_glade, 
+	// у которого размер поля и длина игры задаются параметрами
+
+	std::string exactName = "mushroom_glade_" + std::to_string(config.rowsNum) + "x" +
+		std::to_string(config.colsNum) + "x" + std::to_string(config.gameLength);
+
+	std::string gameName;
+	for (const open_spiel::GameType& type : open_spiel::RegisteredGameTypes()) {
+		int rowsNum, colsNum, gameLength;
+		if (!GladeShape(type, rowsNum, colsNum, gameLength)
+			|| rowsNum != config.rowsNum || colsNum != config.colsNum || gameLength != config.gameLength) {
+			continue;
+		}
+		if (gameName.empty() || type.short_name == exactName) {
+			gameName = type.short_name;
+		}
+	}
+
+	params.clear();
+	if (gameName.empty()) {
+		int cellsNum = config.rowsNum * config.colsNum;
+		if (config.rowsNum < 1 || config.colsNum < 1 || cellsNum > open_spiel::MushroomGlade::kMaxNumCells
+			|| config.gameLength < 1 || config.gameLength > cellsNum) {
+			return gameName;
+		}
+		gameName = kRuntimeGame;
+		params["rows_num"] = open_spiel::GameParameter(config.rowsNum);
+		params["cols_num"] = open_spiel::GameParameter(config.colsNum);
+		params["max_game_length"] = open_spiel::GameParameter(config.gameLength);
+	}
+	return gameName;
+}
+
+std::vector<SweepResult> ParameterSweep::Run(unsigned threadsNum) {
+
+	// Таблицы игры принадлежат её объекту и после 
+	// создания только читаются, поэтому каждая точка 
+	// сетки считается отдельной задачей, в том числе 
+	// точки одного варианта игры. bonus_diff на игру не влияет, 
+	// поэтому из точек с одинаковой формой поля и длиной игры 
+	// считается первая, остальные копируют её результат
+
+	std::vector<SweepResult> results(configs.size());
+	std::vector<open_spiel::GameParameters> params(configs.size());
+	std::vector<size_t> points;
+	std::vector<size_t> sources(configs.size());
+	std::map<std::tuple<int, int, int>, size_t> firstPoints;
+	for (size_t i = 0; i < configs.size(); i++) {
+		results[i].config = configs[i];
+		results[i].gameName = ResolveGame(configs[i], params[i]);
+		if (results[i].gameName.empty()) {
+			results[i].error = "Board size is not supported";
+			continue;
+		}
+		auto [first, inserted] = firstPoints.emplace(
+			std::make_tuple(configs[i].rowsNum, configs[i].colsNum, configs[i].gameLength), i);
+		sources[i] = first->second;
+		if (inserted) {
+			points.push_back(i);
+		}
+	}
+	for (const auto& config : configs) {
+		if (config.bonusDiff != configs.front().bonusDiff) {
+			std::cerr << "Warning: bonus_diff is not applied yet, "
+				"points that differ only in bonus_diff get the same result" << std::endl;
+			break;
+		}
+	}
+
+	std::mutex outMutex;
+	auto analyzePoint = [&results, &params, &outMutex](size_t i) {
+		{
+			std::lock_guard<std::mutex> lock(outMutex);
+			std::cout << "Sweep: " << results[i].gameName << "\n";
+		}
+		try {
+			Analyze(params[i], results[i]);
+		}
+		catch (const std::exception& ex) {
+			results[i].error = ex.what();
+		}
+	};
+
+	if (threadsNum == 1) {
+		for (size_t i : points) {
+			analyzePoint(i);
+		}
+	}
+	else {
+		ThreadPool pool(threadsNum);
+		for (size_t i : points) {
+			pool.Submit([&analyzePoint, i]() { analyzePoint(i); });
+		}
+		pool.Wait();
+	}
+
+	for (size_t i = 0; i < configs.size(); i++) {
+		if (!results[i].gameName.empty() && sources[i] != i) {
+			SweepConfig config = results[i].config;
+			results[i] = results[sources[i]];
+			results[i].config = config;
+		}
+	}
+	return results;
+}
+
+void ParameterSweep::Analyze(const open_spiel::GameParameters& params, SweepResult& result) {
+
+	// Исходы всех партий и значения досок при оптимальной игре. 
+	// Параллельность - между точками сетки, поэтому внутри 
+	// одной точки всё считается в одном потоке
+
+	auto start = std::chrono::high_resolution_clock::now();
+
+	auto game = open_spiel::LoadGame(result.gameName, params);
+
+	ChanceNodeGameAnalysis gameAnalysis;
+	result.outcomes = gameAnalysis.GetStrategyNum(game->NewInitialState());
+
+	std::vector<BoardValue> values = MinimaxSolver::SolveBoards(*game->NewInitialState(), 1);
+	result.optimalBoards.assign(3, 0);
+	for (const auto& value : values) {
+		result.optimalBoards[value.value > 0 ? 0 : value.value < 0 ? 1 : 2]++;
+	}
+
+	auto end = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> duration = end - start;
+	result.seconds = duration.count();
+}
+
+void ParameterSweep::WriteResults(const std::vector<SweepResult>& results, const std::string& fileName) {
+
+	// Одна строка на точку сетки, доли исходов - как у FixChanceNodeResult
+
+	std::ofstream out;
+	out.open(fileName, std::ios::app);
+	out << "Rows_num;Cols_num;Game_length;Bonus_diff;Game_name;Chance_nodes_num;" <<
+		"First_player_wins_num;Second_player_wins_num;Equal_results_num;All_variants_num;" <<
+		"First_player_wins_percent;Second_player_wins_percent;Equal_results_percent;" <<
+		"Optimal_first_player_boards;Optimal_second_player_boards;Optimal_equal_boards;" <<
+		"Time_s;Error;\n";
+
+	for (const auto& result : results) {
+		const SweepConfig& config = result.config;
+		OutcomeCounter winX = result.outcomes[0], winO = result.outcomes[1], equalRezults = result.outcomes[2];
+		double allWins = winX + winO + equalRezults;
+		if (allWins == 0) {
+			allWins = 1;
+		}
+
+		out << config.rowsNum << ";" << config.colsNum << ";" << config.gameLength << ";" << config.bonusDiff << ";" <<
+			result.gameName << ";" << result.outcomes[3] << ";" <<
+			winX << ";" << winO << ";" << equalRezults << ";" << winX + winO + equalRezults << ";" <<
+			winX / allWins << ";" << winO / allWins << ";" << equalRezults / allWins << ";" <<
+			result.optimalBoards[0] << ";" << result.optimalBoards[1] << ";" << result.optimalBoards[2] << ";" <<
+			result.seconds << ";" << result.error << ";\n";
+	}
+	out.close();
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <string>
+#include <fstream>
+
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+#include "../GameAnalysis/GameAnalysis.h"
+
+
+/////////////////////ParameterSweep///////////////////////
+// Анализ баланса Грибной поляны по сетке параметров.
+// Каждая точка сетки (строки, столбцы, длина игры, bonus_diff) 
+// сопоставляется зарегистрированному варианту игры 
+// (или mushroom_glade с размером поля из параметров), 
+// точки анализируются параллельно в пуле потоков, 
+// результаты собираются в одну таблицу.
+// Ограничение: bonus_diff пока не читается ни одним вариантом игры. 
+// Точки, отличающиеся только bonus_diff, считаются один раз 
+// и получают одинаковый результат; если в сетке несколько 
+// значений bonus_diff, Run один раз выводит предупреждение
+
+// Точка сетки параметров
+struct SweepConfig {
+	int rowsNum;
+	int colsNum;
+	int gameLength;
+	int bonusDiff;
+};
+
+// Результат анализа одной точки сетки
+struct SweepResult {
+	SweepConfig config;
+	std::string gameName;  // Вариант игры, пустая строка - вариант не найден
+	// Исходы всех партий, как у GetStrategyNum: победы первого, 
+	// второго игрока, ничьи, количество начальных состояний
+	std::vector<OutcomeCounter> outcomes{ 0, 0, 0, 0 };
+	// Доски, выигранные при оптимальной игре: первым, вторым игроком, ничьи
+	std::vector<OutcomeCounter> optimalBoards{ 0, 0, 0 };
+	double seconds{ 0 };
+	std::string error;  // Причина, по которой точка не посчитана
+};
+
+class ParameterSweep {
+public:
+	// Сетка - все сочетания значений
+	ParameterSweep(const std::vector<int>& rowsNums, const std::vector<int>& colsNums,
+		const std::vector<int>& gameLengths, const std::vector<int>& bonusDiffs);
+	explicit ParameterSweep(std::vector<SweepConfig> configs_) : configs(std::move(configs_)) {}
+
+	const std::vector<SweepConfig>& GetConfigs() const { return configs; }
+
+	// Вариант игры и его параметры для точки сетки, без bonus_diff.
+	// Пустая строка - поле точки не помещается в 64 ячейки 
+	// или длина игры больше количества ячеек
+	static std::string ResolveGame(const SweepConfig&, open_spiel::GameParameters&);
+
+	// Посчитать все точки в пуле из threadsNum потоков (0 - по количеству ядер).
+	// Точки с одинаковыми строками, столбцами и длиной игры 
+	// получают результат одного анализа.
+	// Результаты идут в порядке точек сетки
+	std::vector<SweepResult> Run(unsigned threadsNum);
+
+	// Записать сводную таблицу результатов
+	static void WriteResults(const std::vector<SweepResult>&, const std::string&);
+
+private:
+	static void Analyze(const open_spiel::GameParameters&, SweepResult&);
+
+	std::vector<SweepConfig> configs;
+};
@@ -0,0 +1,125 @@
+#include "ThreadPool.h"
+
+unsigned ThreadPool::DefaultThreadsNum() {
+	unsigned threadsNum = std::thread::hardware_concurrency();
+	return threadsNum == 0 ? 1 : threadsNum;
+}
+
+ThreadPool::ThreadPool(unsigned threadsNum) {
+	if (threadsNum == 0) {
+		threadsNum = DefaultThreadsNum();
+	}
+
+	queues.reserve(threadsNum);
+	for (unsigned i = 0; i < threadsNum; i++) {
+		queues.push_back(std::make_unique<TaskQueue>());
+	}
+
+	workers.reserve(threadsNum);
+	for (unsigned i = 0; i < threadsNum; i++) {
+		workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(stateMutex);
+		stopping = true;
+	}
+	taskAdded.notify_all();
+	for (auto& worker : workers) {
+		worker.join();
+	}
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+
+	// Задачи раскладываются по очередям потоков по кругу
+
+	unsigned index = nextQueue.fetch_add(1) % queues.size();
+	pendingTasks.fetch_add(1);
+	queuedTasks.fetch_add(1);
+	{
+		std::lock_guard<std::mutex> lock(queues[index]->mutex);
+		queues[index]->tasks.push_back(std::move(task));
+	}
+	{
+		// Захват мьютекса не даёт потоку пропустить
+		// оповещение между проверкой очередей и ожиданием
+		std::lock_guard<std::mutex> lock(stateMutex);
+	}
+	taskAdded.notify_one();
+}
+
+void ThreadPool::Wait() {
+	std::unique_lock<std::mutex> lock(stateMutex);
+	tasksDone.wait(lock, [this]() { return pendingTasks.load() == 0; });
+
+	if (taskError) {
+		std::exception_ptr error = taskError;
+		taskError = nullptr;
+		std::rethrow_exception(error);
+	}
+}
+
+bool ThreadPool::PopTask(unsigned index, std::function<void()>& task) {
+
+	// Сначала задача берётся из своей очереди,
+	// затем перехватывается из очередей других потоков
+
+	{
+		std::lock_guard<std::mutex> lock(queues[index]->mutex);
+		if (!queues[index]->tasks.empty()) {
+			task = std::move(queues[index]->tasks.front());
+			queues[index]->tasks.pop_front();
+			queuedTasks.fetch_sub(1);
+			return true;
+		}
+	}
+
+	for (size_t i = 1; i < queues.size(); i++) {
+		auto& victim = queues[(index + i) % queues.size()];
+		std::lock_guard<std::mutex> lock(victim->mutex);
+		if (!victim->tasks.empty()) {
+			task = std::move(victim->tasks.back());
+			victim->tasks.pop_back();
+			queuedTasks.fetch_sub(1);
+			return true;
+		}
+	}
+	return false;
+}
+
+void ThreadPool::WorkerLoop(unsigned index) {
+	std::function<void()> task;
+	while (true) {
+		if (PopTask(index, task)) {
+			try {
+				task();
+			}
+			catch (...) {
+				std::lock_guard<std::mutex> lock(stateMutex);
+				if (!taskError) {
+					taskError = std::current_exception();
+				}
+			}
+			task = nullptr;
+
+			if (pendingTasks.fetch_sub(1) == 1) {
+				std::lock_guard<std::mutex> lock(stateMutex);
+				tasksDone.notify_all();
+			}
+			continue;
+		}
+
+		// Задач нет ни в одной очереди - поток засыпает
+		// до появления новой задачи или остановки пула
+		std::unique_lock<std::mutex> lock(stateMutex);
+		if (stopping && queuedTasks.load() == 0) {
+			return;
+		}
+		taskAdded.wait(lock, [this]() {
+			return stopping || queuedTasks.load() > 0;
+		});
+	}
+}
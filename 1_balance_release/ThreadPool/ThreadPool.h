@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/////////////////////ThreadPool///////////////////////
+// Пул потоков с перехватом задач (work stealing).
+// У каждого потока своя очередь задач: поток берёт задачи
+// из начала своей очереди, а когда она пуста -
+// забирает задачи с конца очередей других потоков
+
+class ThreadPool {
+public:
+	// threadsNum - количество потоков,
+	// 0 - по количеству ядер процессора
+	explicit ThreadPool(unsigned threadsNum = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// Добавить задачу в пул
+	void Submit(std::function<void()>);
+
+	// Дождаться выполнения всех добавленных задач.
+	// Если одна из задач завершилась исключением,
+	// оно пробрасывается дальше
+	void Wait();
+
+	// Количество потоков в пуле
+	unsigned Size() const { return static_cast<unsigned>(workers.size()); }
+
+	// Количество потоков по умолчанию
+	static unsigned DefaultThreadsNum();
+
+private:
+	// Очередь задач одного потока
+	struct TaskQueue {
+		std::mutex mutex;
+		std::deque<std::function<void()>> tasks;
+	};
+
+	void WorkerLoop(unsigned);
+	bool PopTask(unsigned, std::function<void()>&);
+
+	std::vector<std::unique_ptr<TaskQueue>> queues;
+	std::vector<std::thread> workers;
+
+	// Номер очереди для следующей задачи
+	std::atomic<unsigned> nextQueue{ 0 };
+	// Количество задач, ожидающих в очередях
+	std::atomic<size_t> queuedTasks{ 0 };
+	// Количество добавленных, но ещё не выполненных задач
+	std::atomic<size_t> pendingTasks{ 0 };
+
+	std::mutex stateMutex;
+	std::condition_variable taskAdded;
+	std::condition_variable tasksDone;
+	bool stopping{ false };
+
+	// Первое исключение, выброшенное задачей
+	std::exception_ptr taskError;
+};